@@ -0,0 +1,257 @@
+/**
+ * @file eth_mac_bench.c
+ * @brief Send and receive throughput of the ETH MAC driver against the host DMA model
+ *
+ * Frames are sent in bursts with XMC_ETH_MAC_SendFrame() and looped back by the model.
+ * They are read either with a copy, one by one with XMC_ETH_MAC_ReadFrame() or in a batch
+ * with XMC_ETH_MAC_ReadFrames(), or borrowed without a copy with XMC_ETH_MAC_BorrowRxFrame()
+ * or XMC_ETH_MAC_BorrowRxFrames() and given back with XMC_ETH_MAC_ReturnRxFrame(). Only the
+ * driver calls are timed, the model is not. Every
+ * received frame is checked against its sequence number, a lost or corrupted frame
+ * fails the run.
+ *
+ * Usage: eth_mac_bench [frames]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "eth_mac_model.h"
+#include "host_timer.h"
+
+#define BENCH_NUM_BUF        (16U)     /* Descriptors per ring */
+#define BENCH_BURST          (8U)      /* Frames sent between two model runs */
+#define BENCH_DEFAULT_FRAMES (200000U) /* Frames per measurement */
+#define BENCH_SEQ_OFFSET     (14U)     /* Sequence number right after the MAC header */
+
+/* Receive path under test */
+typedef enum BENCH_RX_MODE
+{
+  BENCH_RX_MODE_SINGLE,       /* XMC_ETH_MAC_GetRxFrameSize() and XMC_ETH_MAC_ReadFrame() per frame */
+  BENCH_RX_MODE_BATCH,        /* XMC_ETH_MAC_ReadFrames() per burst */
+  BENCH_RX_MODE_BORROW,       /* XMC_ETH_MAC_BorrowRxFrame() and XMC_ETH_MAC_ReturnRxFrame() per frame */
+  BENCH_RX_MODE_BORROW_BATCH, /* XMC_ETH_MAC_BorrowRxFrames() per burst, XMC_ETH_MAC_ReturnRxFrame() per frame */
+  BENCH_RX_MODE_NUM
+} BENCH_RX_MODE_t;
+
+/* Receive side state, also the XMC_ETH_MAC_ReadFrames() handler context */
+typedef struct BENCH_RX
+{
+  uint32_t expected; /* Next sequence number */
+  uint32_t len;      /* Length of every frame */
+  uint32_t errors;   /* Frames with a wrong length or sequence number */
+} BENCH_RX_t;
+
+/* Descriptors and buffers are static, their addresses fit the 32-bit descriptor words */
+static XMC_ETH_MAC_DMA_DESC_t bench_rx_desc[BENCH_NUM_BUF];
+static XMC_ETH_MAC_DMA_DESC_t bench_tx_desc[BENCH_NUM_BUF];
+static uint8_t bench_rx_buf[BENCH_NUM_BUF * XMC_ETH_MAC_BUF_SIZE];
+static uint8_t bench_tx_buf[BENCH_NUM_BUF * XMC_ETH_MAC_BUF_SIZE];
+static uint8_t bench_frame[XMC_ETH_MAC_BUF_SIZE];
+static uint8_t bench_copy[XMC_ETH_MAC_BUF_SIZE];
+static uint8_t bench_pool_buf[BENCH_NUM_BUF * XMC_ETH_MAC_BUF_SIZE];
+static uint8_t *bench_pool[BENCH_NUM_BUF];
+static XMC_ETH_MAC_RX_FRAME_t bench_borrowed[BENCH_NUM_BUF];
+static ETH_MODEL_t bench_model;
+static XMC_ETH_MAC_t bench_eth_mac;
+
+static const uint32_t bench_sizes[] = {60U, 256U, 1024U, 1514U};
+
+/* Check a received frame */
+static void BENCH_lCheckFrame(const uint8_t *frame, uint32_t len, void *context)
+{
+  BENCH_RX_t *const rx = (BENCH_RX_t *)context;
+  uint32_t seq;
+
+  memcpy(&seq, &frame[BENCH_SEQ_OFFSET], sizeof(seq));
+  if ((len != rx->len) || (seq != rx->expected))
+  {
+    rx->errors++;
+  }
+  rx->expected = seq + 1U;
+}
+
+/* Batch handler, copies the frame out like XMC_ETH_MAC_ReadFrame() does */
+static void BENCH_lCopyFrame(const uint8_t *frame, uint32_t len, void *context)
+{
+  memcpy(bench_copy, frame, len);
+  BENCH_lCheckFrame(bench_copy, len, context);
+}
+
+/* Bring the driver and the model to the state after XMC_ETH_MAC_Init() */
+static void BENCH_lInit(void)
+{
+  ETH_MODEL_Init(&bench_model);
+
+  memset(&bench_eth_mac, 0, sizeof(bench_eth_mac));
+  bench_eth_mac.regs = &bench_model.regs;
+  bench_eth_mac.rx_desc = bench_rx_desc;
+  bench_eth_mac.tx_desc = bench_tx_desc;
+  bench_eth_mac.rx_buf = bench_rx_buf;
+  bench_eth_mac.tx_buf = bench_tx_buf;
+  bench_eth_mac.num_rx_buf = (uint8_t)BENCH_NUM_BUF;
+  bench_eth_mac.num_tx_buf = (uint8_t)BENCH_NUM_BUF;
+
+  /* XMC_ETH_MAC_Init() itself waits for the software reset, which the model does not run */
+  XMC_ETH_MAC_InitRxDescriptors(&bench_eth_mac);
+  XMC_ETH_MAC_InitTxDescriptors(&bench_eth_mac);
+  XMC_ETH_MAC_InitRxBufferPool(&bench_eth_mac, bench_pool, bench_pool_buf, (uint8_t)BENCH_NUM_BUF);
+  XMC_ETH_MAC_EnableTx(&bench_eth_mac);
+  XMC_ETH_MAC_EnableRx(&bench_eth_mac);
+}
+
+/* Send and receive frames of one size, returns false on a lost or corrupted frame */
+static bool BENCH_lRun(uint32_t size, BENCH_RX_MODE_t mode, uint32_t frames,
+                       HOST_TIMER_t *const tx_timer, HOST_TIMER_t *const rx_timer)
+{
+  BENCH_RX_t rx;
+  XMC_ETH_MAC_RX_FRAME_t frame;
+  XMC_ETH_MAC_STATUS_t status;
+  uint32_t seq;
+  uint32_t len;
+  uint32_t num;
+  uint32_t i;
+  bool ok;
+
+  BENCH_lInit();
+  memset(tx_timer, 0, sizeof(*tx_timer));
+  memset(rx_timer, 0, sizeof(*rx_timer));
+  memset(bench_frame, 0xA5, sizeof(bench_frame));
+
+  rx.expected = 0U;
+  rx.len = size;
+  rx.errors = 0U;
+
+  ok = true;
+  for (seq = 0U; ok && (seq < frames); seq += BENCH_BURST)
+  {
+    HOST_TIMER_Start(tx_timer);
+    for (i = 0U; ok && (i < BENCH_BURST); ++i)
+    {
+      len = seq + i;
+      memcpy(&bench_frame[BENCH_SEQ_OFFSET], &len, sizeof(len));
+      ok = (XMC_ETH_MAC_SendFrame(&bench_eth_mac, bench_frame, size, 0U) == XMC_ETH_MAC_STATUS_OK);
+    }
+    HOST_TIMER_Stop(tx_timer);
+
+    (void)ETH_MODEL_Run(&bench_model, 0U);
+
+    HOST_TIMER_Start(rx_timer);
+    if (mode == BENCH_RX_MODE_BATCH)
+    {
+      (void)XMC_ETH_MAC_ReadFrames(&bench_eth_mac, BENCH_lCopyFrame, &rx, BENCH_NUM_BUF);
+    }
+    else if (mode == BENCH_RX_MODE_BORROW)
+    {
+      /* The frame is checked in place, then its buffer goes back to the pool */
+      status = XMC_ETH_MAC_BorrowRxFrame(&bench_eth_mac, &frame);
+      while (status != XMC_ETH_MAC_STATUS_BUSY)
+      {
+        if (status == XMC_ETH_MAC_STATUS_OK)
+        {
+          BENCH_lCheckFrame(frame.buffer, frame.length, &rx);
+          XMC_ETH_MAC_ReturnRxFrame(&bench_eth_mac, &frame);
+        }
+        status = XMC_ETH_MAC_BorrowRxFrame(&bench_eth_mac, &frame);
+      }
+    }
+    else if (mode == BENCH_RX_MODE_BORROW_BATCH)
+    {
+      num = XMC_ETH_MAC_BorrowRxFrames(&bench_eth_mac, bench_borrowed, BENCH_NUM_BUF);
+      for (i = 0U; i < num; ++i)
+      {
+        BENCH_lCheckFrame(bench_borrowed[i].buffer, bench_borrowed[i].length, &rx);
+        XMC_ETH_MAC_ReturnRxFrame(&bench_eth_mac, &bench_borrowed[i]);
+      }
+    }
+    else
+    {
+      /* The frame size reads beyond the buffer size while the descriptor is owned by the DMA */
+      len = XMC_ETH_MAC_GetRxFrameSize(&bench_eth_mac);
+      while ((len > 0U) && (len <= (uint32_t)XMC_ETH_MAC_BUF_SIZE))
+      {
+        (void)XMC_ETH_MAC_ReadFrame(&bench_eth_mac, bench_copy, len);
+        BENCH_lCheckFrame(bench_copy, len, &rx);
+        len = XMC_ETH_MAC_GetRxFrameSize(&bench_eth_mac);
+      }
+    }
+    HOST_TIMER_Stop(rx_timer);
+  }
+
+  return ok && (rx.errors == 0U) && (rx.expected == seq) && (bench_model.rx_missed == 0U) &&
+         (bench_eth_mac.rx_pool_count == (uint8_t)BENCH_NUM_BUF);
+}
+
+/* Print frames per second and cycles per frame of one measurement */
+static void BENCH_lPrint(const HOST_TIMER_t *const timer, uint32_t frames)
+{
+  double seconds = (double)timer->nanoseconds / 1.0e9;
+
+  printf(" %11.0f %9.1f", (double)frames / seconds, (double)timer->cycles / (double)frames);
+}
+
+int main(int argc, char *argv[])
+{
+  static const char *const mode_names[BENCH_RX_MODE_NUM] = {"read", "batch", "borrow", "borrow batch"};
+  HOST_TIMER_t tx_timer[BENCH_RX_MODE_NUM];
+  HOST_TIMER_t rx_timer[BENCH_RX_MODE_NUM];
+  uint32_t frames;
+  uint32_t mode;
+  uint32_t i;
+  int result;
+  bool ok;
+
+  frames = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : BENCH_DEFAULT_FRAMES;
+  frames = ((frames + BENCH_BURST - 1U) / BENCH_BURST) * BENCH_BURST;
+
+  if (((uintptr_t)&bench_rx_buf[sizeof(bench_rx_buf) - 1U] > UINT32_MAX) ||
+      ((uintptr_t)&bench_tx_desc[BENCH_NUM_BUF - 1U] > UINT32_MAX) ||
+      ((uintptr_t)&bench_pool_buf[sizeof(bench_pool_buf) - 1U] > UINT32_MAX) ||
+      ((uintptr_t)&bench_frame[sizeof(bench_frame) - 1U] > UINT32_MAX))
+  {
+    fprintf(stderr, "eth_mac_bench: static data above 4 GiB, build without PIE or with -m32\n");
+    return EXIT_FAILURE;
+  }
+
+  printf("%u frames per size, bursts of %u, rings of %u descriptors\n",
+         (unsigned)frames, (unsigned)BENCH_BURST, (unsigned)BENCH_NUM_BUF);
+  printf("%6s %21s", "", "send");
+  for (mode = 0U; mode < BENCH_RX_MODE_NUM; ++mode)
+  {
+    printf(" %21s", mode_names[mode]);
+  }
+  printf("\n%6s", "size");
+  for (mode = 0U; mode <= BENCH_RX_MODE_NUM; ++mode)
+  {
+    printf(" %11s %9s", "fps", "cyc/frame");
+  }
+  printf("\n");
+
+  result = EXIT_SUCCESS;
+  for (i = 0U; i < (sizeof(bench_sizes) / sizeof(bench_sizes[0])); ++i)
+  {
+    ok = true;
+    for (mode = 0U; ok && (mode < BENCH_RX_MODE_NUM); ++mode)
+    {
+      ok = BENCH_lRun(bench_sizes[i], (BENCH_RX_MODE_t)mode, frames, &tx_timer[mode], &rx_timer[mode]);
+    }
+
+    if (!ok)
+    {
+      fprintf(stderr, "eth_mac_bench: loopback failed for %u byte frames, %s\n",
+              (unsigned)bench_sizes[i], mode_names[mode - 1U]);
+      result = EXIT_FAILURE;
+    }
+    else
+    {
+      printf("%6u", (unsigned)bench_sizes[i]);
+      BENCH_lPrint(&tx_timer[BENCH_RX_MODE_SINGLE], frames);
+      for (mode = 0U; mode < BENCH_RX_MODE_NUM; ++mode)
+      {
+        BENCH_lPrint(&rx_timer[mode], frames);
+      }
+      printf("\n");
+    }
+  }
+
+  return result;
+}
@@ -0,0 +1,206 @@
+/**
+ * @file eth_mac_model.c
+ * @brief Host model of the ETH0 DMA descriptor engine
+ */
+#include <string.h>
+#include "eth_mac_model.h"
+
+/* Descriptor bits used by the DMA, see the reference manual */
+#define ETH_MODEL_TDES0_OWN  (0x80000000U) /* Own bit 1=DMA, 0=CPU */
+#define ETH_MODEL_TDES0_IC   (0x40000000U) /* Interrupt on completion */
+#define ETH_MODEL_TDES0_LS   (0x20000000U) /* Last segment */
+#define ETH_MODEL_TDES0_DP   (0x04000000U) /* Disable pad */
+#define ETH_MODEL_TDES0_TER  (0x00200000U) /* Transmit end of ring */
+#define ETH_MODEL_TDES0_TCH  (0x00100000U) /* Second address chained */
+#define ETH_MODEL_TDES1_TBS1 (0x00001FFFU) /* Transmit buffer 1 size */
+
+#define ETH_MODEL_RDES0_OWN  (0x80000000U) /* Own bit 1=DMA, 0=CPU */
+#define ETH_MODEL_RDES0_FL_Pos (16U)       /* Frame length position, includes the CRC */
+#define ETH_MODEL_RDES0_ES   (0x00008000U) /* Error summary */
+#define ETH_MODEL_RDES0_LE   (0x00001000U) /* Length error */
+#define ETH_MODEL_RDES0_FS   (0x00000200U) /* First descriptor */
+#define ETH_MODEL_RDES0_LS   (0x00000100U) /* Last descriptor */
+#define ETH_MODEL_RDES1_DIC  (0x80000000U) /* Disable interrupt on completion */
+#define ETH_MODEL_RDES1_RER  (0x00008000U) /* Receive end of ring */
+#define ETH_MODEL_RDES1_RCH  (0x00004000U) /* Second address chained */
+#define ETH_MODEL_RDES1_RBS1 (0x00001FFFU) /* Receive buffer 1 size */
+
+#define ETH_MODEL_MIN_FRAME_SIZE (60U)     /* Frame size the MAC pads to, without CRC */
+#define ETH_MODEL_CRC_SIZE       (4U)
+
+#define ETH_MODEL_DESC(addr) ((XMC_ETH_MAC_DMA_DESC_t *)(uintptr_t)(addr))
+#define ETH_MODEL_BUFFER(addr) ((uint8_t *)(uintptr_t)(addr))
+
+/* Next transmit descriptor, chained through buffer 2 or consecutive in a ring */
+static XMC_ETH_MAC_DMA_DESC_t *ETH_MODEL_lNextTxDescriptor(const ETH_MODEL_t *const model,
+                                                           XMC_ETH_MAC_DMA_DESC_t *const desc)
+{
+  XMC_ETH_MAC_DMA_DESC_t *next;
+
+  if ((desc->status & ETH_MODEL_TDES0_TCH) != 0U)
+  {
+    next = ETH_MODEL_DESC(desc->buffer2);
+  }
+  else if ((desc->status & ETH_MODEL_TDES0_TER) != 0U)
+  {
+    next = ETH_MODEL_DESC(model->tx_list);
+  }
+  else
+  {
+    next = desc + 1;
+  }
+
+  return next;
+}
+
+/* Next receive descriptor, chained through buffer 2 or consecutive in a ring */
+static XMC_ETH_MAC_DMA_DESC_t *ETH_MODEL_lNextRxDescriptor(const ETH_MODEL_t *const model,
+                                                           XMC_ETH_MAC_DMA_DESC_t *const desc)
+{
+  XMC_ETH_MAC_DMA_DESC_t *next;
+
+  if ((desc->length & ETH_MODEL_RDES1_RCH) != 0U)
+  {
+    next = ETH_MODEL_DESC(desc->buffer2);
+  }
+  else if ((desc->length & ETH_MODEL_RDES1_RER) != 0U)
+  {
+    next = ETH_MODEL_DESC(model->rx_list);
+  }
+  else
+  {
+    next = desc + 1;
+  }
+
+  return next;
+}
+
+/* Fetch one frame from the transmit ring into the FIFO, returns its length or zero if none is owned */
+static uint32_t ETH_MODEL_lTransmit(ETH_MODEL_t *const model)
+{
+  XMC_ETH_MAC_DMA_DESC_t *desc;
+  uint32_t status;
+  uint32_t size;
+  uint32_t len;
+
+  len = 0U;
+  desc = model->tx_desc;
+  if ((desc->status & ETH_MODEL_TDES0_OWN) == 0U)
+  {
+    /* Transmit buffer unavailable, the DMA suspends until the next poll demand */
+    model->regs.STATUS |= (uint32_t)ETH_STATUS_TU_Msk;
+  }
+  else
+  {
+    /* Gather the segments up to the last one and hand each descriptor back */
+    do
+    {
+      status = desc->status;
+      size = desc->length & ETH_MODEL_TDES1_TBS1;
+      if ((len + size) > ETH_MODEL_MAX_FRAME_SIZE)
+      {
+        size = ETH_MODEL_MAX_FRAME_SIZE - len;
+      }
+      memcpy(&model->frame[len], ETH_MODEL_BUFFER(desc->buffer1), size);
+      len += size;
+
+      desc->status = status & ~ETH_MODEL_TDES0_OWN;
+      desc = ETH_MODEL_lNextTxDescriptor(model, desc);
+    } while (((status & ETH_MODEL_TDES0_LS) == 0U) && ((desc->status & ETH_MODEL_TDES0_OWN) != 0U));
+
+    model->tx_desc = desc;
+    model->tx_frames++;
+
+    if (((status & ETH_MODEL_TDES0_DP) == 0U) && (len < ETH_MODEL_MIN_FRAME_SIZE))
+    {
+      memset(&model->frame[len], 0, ETH_MODEL_MIN_FRAME_SIZE - len);
+      len = ETH_MODEL_MIN_FRAME_SIZE;
+    }
+
+    if ((status & ETH_MODEL_TDES0_IC) != 0U)
+    {
+      model->regs.STATUS |= (uint32_t)ETH_STATUS_TI_Msk | (uint32_t)ETH_STATUS_NIS_Msk;
+    }
+  }
+
+  return len;
+}
+
+/* Write the frame in the FIFO to the receive ring */
+static void ETH_MODEL_lReceive(ETH_MODEL_t *const model, uint32_t len)
+{
+  XMC_ETH_MAC_DMA_DESC_t *desc;
+  uint32_t status;
+  uint32_t size;
+
+  desc = model->rx_desc;
+  if ((desc->status & ETH_MODEL_RDES0_OWN) == 0U)
+  {
+    /* Receive buffer unavailable, the frame is lost */
+    model->rx_missed++;
+    model->regs.STATUS |= (uint32_t)ETH_STATUS_RU_Msk;
+  }
+  else
+  {
+    /* The driver uses one buffer per frame, a longer frame is cut and flagged */
+    status = ETH_MODEL_RDES0_FS | ETH_MODEL_RDES0_LS;
+    size = desc->length & ETH_MODEL_RDES1_RBS1;
+    if (len > size)
+    {
+      len = size;
+      status |= ETH_MODEL_RDES0_ES | ETH_MODEL_RDES0_LE;
+    }
+    memcpy(ETH_MODEL_BUFFER(desc->buffer1), model->frame, len);
+
+    desc->status = status | ((len + ETH_MODEL_CRC_SIZE) << ETH_MODEL_RDES0_FL_Pos);
+    model->rx_desc = ETH_MODEL_lNextRxDescriptor(model, desc);
+    model->rx_frames++;
+
+    if ((desc->length & ETH_MODEL_RDES1_DIC) == 0U)
+    {
+      model->regs.STATUS |= (uint32_t)ETH_STATUS_RI_Msk | (uint32_t)ETH_STATUS_NIS_Msk;
+    }
+  }
+}
+
+/* Reset the register block and the counters */
+void ETH_MODEL_Init(ETH_MODEL_t *const model)
+{
+  memset(model, 0, sizeof(*model));
+}
+
+/* Run the DMA */
+uint32_t ETH_MODEL_Run(ETH_MODEL_t *const model, uint32_t max_frames)
+{
+  const uint32_t started = (uint32_t)ETH_OPERATION_MODE_ST_Msk | (uint32_t)ETH_OPERATION_MODE_SR_Msk;
+  uint32_t count;
+  uint32_t len;
+
+  /* Writing a list address restarts the DMA at the head of the list */
+  if (model->regs.TRANSMIT_DESCRIPTOR_LIST_ADDRESS != model->tx_list)
+  {
+    model->tx_list = model->regs.TRANSMIT_DESCRIPTOR_LIST_ADDRESS;
+    model->tx_desc = ETH_MODEL_DESC(model->tx_list);
+  }
+  if (model->regs.RECEIVE_DESCRIPTOR_LIST_ADDRESS != model->rx_list)
+  {
+    model->rx_list = model->regs.RECEIVE_DESCRIPTOR_LIST_ADDRESS;
+    model->rx_desc = ETH_MODEL_DESC(model->rx_list);
+  }
+
+  count = 0U;
+  if (((model->regs.OPERATION_MODE & started) == started) && (model->tx_desc != NULL) && (model->rx_desc != NULL))
+  {
+    do
+    {
+      len = ETH_MODEL_lTransmit(model);
+      if (len > 0U)
+      {
+        ETH_MODEL_lReceive(model, len);
+        count++;
+      }
+    } while ((len > 0U) && ((max_frames == 0U) || (count < max_frames)));
+  }
+
+  return count;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file eth_mac_model.h
+ * @brief Host model of the ETH0 DMA descriptor engine
+ *
+ * The model owns the register block handed to the driver as XMC_ETH_MAC_t::regs. Each
+ * ETH_MODEL_Run() call plays the DMA: it fetches the frames the driver handed over in the
+ * transmit ring, gives the descriptors back, and writes every frame into the next receive
+ * descriptor owned by the DMA, as the MAC does in loopback mode. Descriptor ownership,
+ * chained and ring addressing, the frame length field and the TI/RI/TU/RU status bits
+ * follow the reference manual. Time stamps, checksum offload, address filtering and the
+ * write-1-to-clear behaviour of STATUS are not modelled.
+ *
+ * The driver keeps buffer and descriptor addresses in 32-bit descriptor words, so every
+ * descriptor and buffer must lie in the lower 4 GiB of the host address space. Static
+ * storage in a non-PIE host executable does, see host/CMakeLists.txt.
+ */
+#ifndef ETH_MAC_MODEL_H
+#define ETH_MAC_MODEL_H
+
+#include "xmc_eth_mac.h"
+
+#define ETH_MODEL_MAX_FRAME_SIZE (XMC_ETH_MAC_BUF_SIZE) /**< Largest frame the transmit FIFO holds */
+
+/**
+ * ETH0 DMA model state
+ */
+typedef struct ETH_MODEL
+{
+  ETH_GLOBAL_TypeDef regs;                  /**< Register block, passed to the driver */
+  XMC_ETH_MAC_DMA_DESC_t *tx_desc;          /**< Current transmit descriptor */
+  XMC_ETH_MAC_DMA_DESC_t *rx_desc;          /**< Current receive descriptor */
+  uint32_t tx_list;                         /**< Transmit list address \a tx_desc was reset to */
+  uint32_t rx_list;                         /**< Receive list address \a rx_desc was reset to */
+  uint32_t tx_frames;                       /**< Frames fetched from the transmit ring */
+  uint32_t rx_frames;                       /**< Frames written to the receive ring */
+  uint32_t rx_missed;                       /**< Frames dropped, receive descriptor owned by the CPU */
+  uint8_t frame[ETH_MODEL_MAX_FRAME_SIZE];  /**< Transmit FIFO, one frame */
+} ETH_MODEL_t;
+
+/**
+ * @param model Model state
+ * @return None
+ *
+ * Reset the register block and the counters. The descriptor lists are picked up from the
+ * list address registers on the next ETH_MODEL_Run().
+ */
+void ETH_MODEL_Init(ETH_MODEL_t *const model);
+
+/**
+ * @param model Model state
+ * @param max_frames Frames to move at most, zero to run until the transmit ring is empty
+ * @return uint32_t Frames fetched from the transmit ring
+ *
+ * Run the DMA. Nothing is moved unless transmission and reception were started with
+ * XMC_ETH_MAC_EnableTx() and XMC_ETH_MAC_EnableRx().
+ */
+uint32_t ETH_MODEL_Run(ETH_MODEL_t *const model, uint32_t max_frames);
+
+#endif /* ETH_MAC_MODEL_H */
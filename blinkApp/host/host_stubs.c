@@ -0,0 +1,46 @@
+/**
+ * @file host_stubs.c
+ * @brief Host stand-ins for the device globals and the SCU functions the host builds link against
+ *
+ * The host builds do not touch clocks or resets, the SCU calls of the drivers do nothing.
+ */
+#include <xmc_scu.h>
+
+uint32_t HOST_PRIMASK;
+uint32_t SystemCoreClock = 144000000U;
+
+void XMC_SCU_CLOCK_EnableClock(const XMC_SCU_CLOCK_t clock)
+{
+  (void)clock;
+}
+
+void XMC_SCU_CLOCK_DisableClock(const XMC_SCU_CLOCK_t clock)
+{
+  (void)clock;
+}
+
+void XMC_SCU_CLOCK_GatePeripheralClock(const XMC_SCU_PERIPHERAL_CLOCK_t peripheral)
+{
+  (void)peripheral;
+}
+
+void XMC_SCU_CLOCK_UngatePeripheralClock(const XMC_SCU_PERIPHERAL_CLOCK_t peripheral)
+{
+  (void)peripheral;
+}
+
+void XMC_SCU_RESET_AssertPeripheralReset(const XMC_SCU_PERIPHERAL_RESET_t peripheral)
+{
+  (void)peripheral;
+}
+
+void XMC_SCU_RESET_DeassertPeripheralReset(const XMC_SCU_PERIPHERAL_RESET_t peripheral)
+{
+  (void)peripheral;
+}
+
+uint32_t XMC_SCU_CLOCK_GetPeripheralClockFrequency(void)
+{
+  /* No peripheral bus divider */
+  return SystemCoreClock;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file host_timer.h
+ * @brief Time base of the host benchmarks
+ *
+ * Cycles come from the time stamp counter on x86 hosts. Elsewhere they read zero and only
+ * the wall-clock figures are meaningful.
+ */
+#ifndef HOST_TIMER_H
+#define HOST_TIMER_H
+
+#include <stdint.h>
+#include <time.h>
+
+/* Host CPU cycles, zero if the host has no usable counter */
+static inline uint64_t HOST_TIMER_GetCycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  /* Builtin, x86intrin.h clashes with the CMSIS __I/__O qualifiers */
+  return __builtin_ia32_rdtsc();
+#else
+  return 0U;
+#endif
+}
+
+/* Monotonic time in nanoseconds */
+static inline uint64_t HOST_TIMER_GetNanoseconds(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Accumulated cost of a measured code section
+ */
+typedef struct HOST_TIMER
+{
+  uint64_t cycles;      /**< Host CPU cycles */
+  uint64_t nanoseconds; /**< Wall-clock time */
+  uint64_t cycles_start;      /**< Counter at the start of the running section */
+  uint64_t nanoseconds_start; /**< Time at the start of the running section */
+} HOST_TIMER_t;
+
+/* Start a measured section */
+static inline void HOST_TIMER_Start(HOST_TIMER_t *const timer)
+{
+  timer->nanoseconds_start = HOST_TIMER_GetNanoseconds();
+  timer->cycles_start = HOST_TIMER_GetCycles();
+}
+
+/* End a measured section and add its cost */
+static inline void HOST_TIMER_Stop(HOST_TIMER_t *const timer)
+{
+  timer->cycles += HOST_TIMER_GetCycles() - timer->cycles_start;
+  timer->nanoseconds += HOST_TIMER_GetNanoseconds() - timer->nanoseconds_start;
+}
+
+#endif /* HOST_TIMER_H */
@@ -0,0 +1,54 @@
+/**
+ * @file cmsis_gcc.h
+ * @brief Host replacement of the CMSIS GCC intrinsics
+ *
+ * Found ahead of include/cmsis_gcc.h on the host include path, so the XMC headers compile
+ * for the build machine. The host has no interrupts to mask, PRIMASK is only tracked.
+ */
+#ifndef __CMSIS_GCC_H
+#define __CMSIS_GCC_H
+
+#include <stdint.h>
+
+extern uint32_t HOST_PRIMASK;
+
+__attribute__((always_inline)) static inline void __enable_irq(void)
+{
+  HOST_PRIMASK = 0U;
+}
+
+__attribute__((always_inline)) static inline void __disable_irq(void)
+{
+  HOST_PRIMASK = 1U;
+}
+
+__attribute__((always_inline)) static inline uint32_t __get_PRIMASK(void)
+{
+  return HOST_PRIMASK;
+}
+
+__attribute__((always_inline)) static inline void __set_PRIMASK(uint32_t priMask)
+{
+  HOST_PRIMASK = priMask;
+}
+
+__attribute__((always_inline)) static inline void __NOP(void)
+{
+}
+
+__attribute__((always_inline)) static inline void __DSB(void)
+{
+  __sync_synchronize();
+}
+
+__attribute__((always_inline)) static inline void __DMB(void)
+{
+  __sync_synchronize();
+}
+
+__attribute__((always_inline)) static inline void __ISB(void)
+{
+  __sync_synchronize();
+}
+
+#endif /* __CMSIS_GCC_H */
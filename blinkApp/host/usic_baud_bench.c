@@ -0,0 +1,252 @@
+/**
+ * @file usic_baud_bench.c
+ * @brief Cost and accuracy of the USIC baud rate divider calculation
+ *
+ * Compares the divider search XMC_USIC_CH_SetBaudrate() used before the continued
+ * fraction solver, reproduced below, with XMC_USIC_CH_CalculateBaudrate(). Both run
+ * over the same peripheral clock, baud rate and oversampling combinations; only the
+ * calculation is timed. XMC_USIC_CH_SetBaudrate() is timed as well, against a USIC
+ * channel in memory. The rate error of every result is checked with
+ * XMC_USIC_CH_GetBaudrateError(), the run fails if the solver is less accurate than
+ * the search on any combination.
+ *
+ * Usage: usic_baud_bench [rounds]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xmc_usic.h>
+#include "host_timer.h"
+
+#define BENCH_DEFAULT_ROUNDS (20U)   /* Passes over all combinations */
+#define BENCH_MAX_CASES      (256U)
+
+/* One peripheral clock, baud rate and oversampling combination */
+typedef struct BENCH_CASE
+{
+  uint32_t peripheral_clock;
+  uint32_t rate;
+  uint32_t oversampling;
+} BENCH_CASE_t;
+
+/* Results of one calculation over all combinations */
+typedef struct BENCH_RESULT
+{
+  HOST_TIMER_t timer;
+  uint32_t max_error;                          /* Largest absolute rate error in ppm */
+  uint32_t invalid;                            /* Combinations without valid divider settings */
+  XMC_USIC_CH_BRG_CONFIG_t config[BENCH_MAX_CASES];
+} BENCH_RESULT_t;
+
+/* Divider calculation under test */
+typedef bool (*BENCH_CALCULATE_t)(const BENCH_CASE_t *const bench_case, XMC_USIC_CH_BRG_CONFIG_t *const config);
+
+static const uint32_t bench_clocks[] = {144000000U, 120000000U, 80000000U, 24000000U};
+static const uint32_t bench_rates[] = {1200U, 9600U, 31250U, 115200U, 460800U, 921600U, 1000000U, 3000000U, 12000000U};
+static const uint32_t bench_oversampling[] = {1U, 2U, 8U, 16U};
+
+static BENCH_CASE_t bench_cases[BENCH_MAX_CASES];
+static BENCH_RESULT_t bench_legacy;
+static BENCH_RESULT_t bench_solver;
+static XMC_USIC_CH_t bench_channel;
+
+/* Divider search of XMC_USIC_CH_SetBaudrate() before the continued fraction solver */
+static bool BENCH_lLegacyCalculate(const BENCH_CASE_t *const bench_case, XMC_USIC_CH_BRG_CONFIG_t *const config)
+{
+  uint32_t peripheral_clock;
+  uint32_t rate;
+  uint32_t clock_divider;
+  uint32_t clock_divider_min;
+  uint32_t pdiv;
+  uint32_t pdiv_int;
+  uint32_t pdiv_int_min;
+  uint32_t pdiv_frac;
+  uint32_t pdiv_frac_min;
+
+  /* The rate and peripheral clock are divided by 100 to be able to use only 32bit arithmetic */
+  peripheral_clock = bench_case->peripheral_clock / 100U;
+  rate = bench_case->rate / 100U;
+
+  clock_divider_min = 1U;
+  pdiv_int_min = 1U;
+  pdiv_frac_min = 0x3ffU;
+
+  for (clock_divider = 1023U; clock_divider > 0U; --clock_divider)
+  {
+    pdiv = ((peripheral_clock * clock_divider) / (rate * bench_case->oversampling));
+    pdiv_int = pdiv >> 10U;
+    pdiv_frac = pdiv & 0x3ffU;
+
+    if ((pdiv_int < 1024U) && (pdiv_frac < pdiv_frac_min))
+    {
+      pdiv_frac_min = pdiv_frac;
+      pdiv_int_min = pdiv_int;
+      clock_divider_min = clock_divider;
+    }
+  }
+
+  config->step = (uint16_t)clock_divider_min;
+  config->pdiv = (uint16_t)pdiv_int_min;
+  config->oversampling = (uint16_t)bench_case->oversampling;
+
+  /* The search accepts a zero integer part, which BRG.PDIV cannot encode */
+  return (pdiv_int_min != 0U);
+}
+
+/* Continued fraction solver */
+static bool BENCH_lSolverCalculate(const BENCH_CASE_t *const bench_case, XMC_USIC_CH_BRG_CONFIG_t *const config)
+{
+  return (XMC_USIC_CH_CalculateBaudrate(bench_case->peripheral_clock, bench_case->rate,
+                                        bench_case->oversampling, config) == XMC_USIC_CH_STATUS_OK);
+}
+
+/* All combinations the prescaler can reach, returns their number */
+static uint32_t BENCH_lInitCases(void)
+{
+  uint32_t num_cases = 0U;
+  uint32_t c;
+  uint32_t r;
+  uint32_t o;
+
+  for (c = 0U; c < (sizeof(bench_clocks) / sizeof(bench_clocks[0])); ++c)
+  {
+    for (r = 0U; r < (sizeof(bench_rates) / sizeof(bench_rates[0])); ++r)
+    {
+      for (o = 0U; o < (sizeof(bench_oversampling) / sizeof(bench_oversampling[0])); ++o)
+      {
+        if (((uint64_t)bench_rates[r] * bench_oversampling[o]) <= ((uint64_t)bench_clocks[c] / 2U))
+        {
+          bench_cases[num_cases].peripheral_clock = bench_clocks[c];
+          bench_cases[num_cases].rate = bench_rates[r];
+          bench_cases[num_cases].oversampling = bench_oversampling[o];
+          ++num_cases;
+        }
+      }
+    }
+  }
+
+  return num_cases;
+}
+
+/* Time a calculation over all combinations and record the rate error of its results */
+static void BENCH_lRun(BENCH_CALCULATE_t calculate, uint32_t num_cases, uint32_t rounds, BENCH_RESULT_t *const result)
+{
+  uint32_t round;
+  uint32_t i;
+  int32_t error;
+  bool valid;
+
+  memset(result, 0, sizeof(*result));
+
+  for (round = 0U; round < rounds; ++round)
+  {
+    HOST_TIMER_Start(&result->timer);
+    for (i = 0U; i < num_cases; ++i)
+    {
+      (void)calculate(&bench_cases[i], &result->config[i]);
+    }
+    HOST_TIMER_Stop(&result->timer);
+  }
+
+  for (i = 0U; i < num_cases; ++i)
+  {
+    valid = calculate(&bench_cases[i], &result->config[i]);
+    if (valid)
+    {
+      error = XMC_USIC_CH_GetBaudrateError(bench_cases[i].peripheral_clock, bench_cases[i].rate, &result->config[i]);
+      error = (error < 0) ? -error : error;
+      if ((uint32_t)error > result->max_error)
+      {
+        result->max_error = (uint32_t)error;
+      }
+    }
+    else
+    {
+      ++result->invalid;
+    }
+  }
+}
+
+/* Time XMC_USIC_CH_SetBaudrate() including the register writes */
+static void BENCH_lRunSetBaudrate(uint32_t num_cases, uint32_t rounds, HOST_TIMER_t *const timer)
+{
+  uint32_t round;
+  uint32_t i;
+
+  memset(timer, 0, sizeof(*timer));
+
+  for (round = 0U; round < rounds; ++round)
+  {
+    for (i = 0U; i < num_cases; ++i)
+    {
+      SystemCoreClock = bench_cases[i].peripheral_clock;
+
+      HOST_TIMER_Start(timer);
+      (void)XMC_USIC_CH_SetBaudrate(&bench_channel, bench_cases[i].rate, bench_cases[i].oversampling);
+      HOST_TIMER_Stop(timer);
+    }
+  }
+}
+
+/* Print calls per second and cycles per call of one measurement */
+static void BENCH_lPrint(const char *const name, const HOST_TIMER_t *const timer, uint32_t calls)
+{
+  double seconds = (double)timer->nanoseconds / 1.0e9;
+
+  printf("%-34s %12.0f %10.1f", name, (double)calls / seconds, (double)timer->cycles / (double)calls);
+}
+
+int main(int argc, char *argv[])
+{
+  HOST_TIMER_t set_timer;
+  uint32_t rounds;
+  uint32_t num_cases;
+  uint32_t worse;
+  uint32_t i;
+  int32_t legacy_error;
+  int32_t solver_error;
+
+  rounds = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : BENCH_DEFAULT_ROUNDS;
+  if (rounds == 0U)
+  {
+    rounds = 1U;
+  }
+
+  num_cases = BENCH_lInitCases();
+
+  BENCH_lRun(BENCH_lLegacyCalculate, num_cases, rounds, &bench_legacy);
+  BENCH_lRun(BENCH_lSolverCalculate, num_cases, rounds, &bench_solver);
+  BENCH_lRunSetBaudrate(num_cases, rounds, &set_timer);
+
+  /* The solver picks the closest pair, it may never lose against the search */
+  worse = 0U;
+  for (i = 0U; i < num_cases; ++i)
+  {
+    if ((bench_legacy.config[i].pdiv != 0U) && (bench_solver.config[i].pdiv != 0U))
+    {
+      legacy_error = XMC_USIC_CH_GetBaudrateError(bench_cases[i].peripheral_clock, bench_cases[i].rate, &bench_legacy.config[i]);
+      solver_error = XMC_USIC_CH_GetBaudrateError(bench_cases[i].peripheral_clock, bench_cases[i].rate, &bench_solver.config[i]);
+      if (abs(solver_error) > abs(legacy_error))
+      {
+        ++worse;
+      }
+    }
+  }
+
+  printf("%u combinations, %u rounds\n", (unsigned)num_cases, (unsigned)rounds);
+  printf("%-34s %12s %10s %14s %8s\n", "", "calls/s", "cyc/call", "max error ppm", "invalid");
+  BENCH_lPrint("divider search (before)", &bench_legacy.timer, num_cases * rounds);
+  printf(" %14u %8u\n", (unsigned)bench_legacy.max_error, (unsigned)bench_legacy.invalid);
+  BENCH_lPrint("XMC_USIC_CH_CalculateBaudrate()", &bench_solver.timer, num_cases * rounds);
+  printf(" %14u %8u\n", (unsigned)bench_solver.max_error, (unsigned)bench_solver.invalid);
+  BENCH_lPrint("XMC_USIC_CH_SetBaudrate()", &set_timer, num_cases * rounds);
+  printf("\n");
+
+  if ((bench_solver.invalid != 0U) || (worse != 0U))
+  {
+    fprintf(stderr, "usic_baud_bench: solver invalid for %u, less accurate than the search for %u combinations\n",
+            (unsigned)bench_solver.invalid, (unsigned)worse);
+  }
+
+  return ((bench_solver.invalid == 0U) && (worse == 0U)) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
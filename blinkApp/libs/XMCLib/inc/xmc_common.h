@@ -257,6 +257,33 @@ __STATIC_INLINE int32_t XMC_PRIOARRAY_GetItemPrevious(XMC_PRIOARRAY_t *prioarray
   return prioarray->items[item].previous;
 }
 
+/*
+ * Index following \a index in a ring of \a size entries. The request queues of the drivers advance their tail with it
+ * before the completion handler runs, so that the handler can queue a follow-up request into the freed entry.
+ */
+__STATIC_INLINE uint8_t XMC_RING_GetNextIndex(const uint8_t index, const uint8_t size)
+{
+  return ((uint32_t)index + 1U == (uint32_t)size) ? 0U : (uint8_t)(index + 1U);
+}
+
+/*
+ * Enter a section that must not be interrupted, return the previous interrupt mask
+ */
+__STATIC_INLINE uint32_t XMC_EnterCriticalSection(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  return primask;
+}
+
+/*
+ * Leave a section that must not be interrupted, restore the interrupt mask returned by XMC_EnterCriticalSection()
+ */
+__STATIC_INLINE void XMC_ExitCriticalSection(const uint32_t primask)
+{
+  __set_PRIMASK(primask);
+}
+
 #ifdef __cplusplus
 }
 #endif
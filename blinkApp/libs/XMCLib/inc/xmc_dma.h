@@ -100,6 +100,13 @@
 #define XMC_DMA1_NUM_CHANNELS 4
 #endif
 
+#define XMC_DMA_LLI_NUM_CHANNELS (2U)      /**< GPDMA0 channels 0 and 1 support linked list multi-block transfers */
+#define XMC_DMA_LLI_MAX_BLOCK_SIZE (2048U) /**< Maximum block size of a linked list item */
+#define XMC_DMA_CH_LATENCY_BINS (16U)             /**< Number of latency histogram bins, see ::XMC_DMA_CH_STATISTICS_t */
+#define XMC_DMA_NO_LINE (0xffU)                   /**< No DLR line reserved or used */
+#define XMC_DMA_NO_PERIPHERAL_REQUEST (0xffU)     /**< Channel requirement without peripheral request */
+#define XMC_DMA_STREAM_NO_LINE XMC_DMA_NO_LINE    /**< Stream without hardware handshaking DLR line */
+
 /*******************************************************************************
  * ENUMS
  *******************************************************************************/
@@ -245,6 +252,19 @@ typedef enum XMC_DMA_CH_STATUS
   XMC_DMA_CH_STATUS_BUSY   /**< DMA is busy */
 } XMC_DMA_CH_STATUS_t;
 
+/**
+ * DMA stream events, passed OR'd to the stream handler
+ */
+typedef enum XMC_DMA_STREAM_EVENT
+{
+  XMC_DMA_STREAM_EVENT_SEGMENT_COMPLETE = 0x1UL,  /**< A segment has been filled (or emptied) */
+  XMC_DMA_STREAM_EVENT_HALF_COMPLETE    = 0x2UL,  /**< The first half of the ring has been filled */
+  XMC_DMA_STREAM_EVENT_FULL_COMPLETE    = 0x4UL,  /**< The last segment of the ring has been filled, the ring wraps */
+  XMC_DMA_STREAM_EVENT_OVERRUN          = 0x8UL,  /**< The channel reached a segment that was not released */
+  XMC_DMA_STREAM_EVENT_REQUEST_OVERRUN  = 0x10UL, /**< A peripheral request was lost in the DLR */
+  XMC_DMA_STREAM_EVENT_ERROR            = 0x20UL  /**< DMA error, the stream is stopped */
+} XMC_DMA_STREAM_EVENT_t;
+
 /*******************************************************************************
  * DATA STRUCTURES
  *******************************************************************************/
@@ -438,6 +458,170 @@ typedef struct XMC_DMA_CH_CONFIG
  */
 typedef void (*XMC_DMA_CH_EVENT_HANDLER_t)(XMC_DMA_CH_EVENT_t event);
 
+/**
+ * DMA channel event handler with user context
+ */
+typedef void (*XMC_DMA_CH_EVENT_CONTEXT_HANDLER_t)(XMC_DMA_CH_EVENT_t event, void *context);
+
+/**
+ * DMA channel event counters, incremented by ::XMC_DMA_IRQHandler()
+ */
+typedef struct XMC_DMA_CH_EVENT_COUNTERS
+{
+  uint32_t transfer_complete;        /**< Transfer complete events */
+  uint32_t block_transfer_complete;  /**< Block transfer complete events */
+  uint32_t src_transaction_complete; /**< Source transaction complete events */
+  uint32_t dst_transaction_complete; /**< Destination transaction complete events */
+  uint32_t error;                    /**< DMA error events */
+} XMC_DMA_CH_EVENT_COUNTERS_t;
+
+#if defined(XMC_DMA_INSTRUMENTATION_ENABLE)
+/**
+ * DMA channel transfer statistics, collected if XMC_DMA_INSTRUMENTATION_ENABLE is defined
+ */
+typedef struct XMC_DMA_CH_STATISTICS
+{
+  uint64_t bytes;                                      /**< Bytes moved by completed blocks */
+  uint64_t busy_cycles;                                /**< Sum of the enable to completion latencies */
+  uint32_t transfers;                                  /**< Completed transfers */
+  uint32_t errors;                                     /**< DMA error events */
+  uint32_t min_latency;                                /**< Shortest enable to completion latency in CPU cycles */
+  uint32_t max_latency;                                /**< Longest enable to completion latency in CPU cycles */
+  uint32_t latency_histogram[XMC_DMA_CH_LATENCY_BINS]; /**< Bin n counts latencies below 2^(n + 7) cycles, the last bin all longer ones */
+} XMC_DMA_CH_STATISTICS_t;
+
+/**
+ * DMA module instrumentation snapshot
+ */
+typedef struct XMC_DMA_INSTRUMENTATION_SNAPSHOT
+{
+  uint32_t timestamp;                                  /**< DWT cycle count when the snapshot was taken */
+  uint32_t elapsed;                                    /**< CPU cycles since the statistics were cleared, wraps after 2^32 */
+  uint8_t num_channels;                                /**< Number of valid entries in \a channels */
+  XMC_DMA_CH_STATISTICS_t channels[XMC_DMA0_NUM_CHANNELS]; /**< Statistics of each channel */
+} XMC_DMA_INSTRUMENTATION_SNAPSHOT_t;
+#endif
+
+/**
+ * DMA channel requirements, used to allocate a channel at runtime
+ */
+typedef struct XMC_DMA_CH_REQUIREMENTS
+{
+  XMC_DMA_t *dma;                           /**< Module of the peripheral requests, NULL for any module */
+  const char *owner;                        /**< Name of the user, reported in the channel mapping */
+  uint32_t bytes_per_second;                /**< Expected data rate, reported as channel load */
+  XMC_DMA_CH_TRANSFER_WIDTH_t width;        /**< Widest transfer width used */
+  XMC_DMA_CH_BURST_LENGTH_t burst_length;   /**< Longest burst length used */
+  XMC_DMA_CH_PRIORITY_t priority;           /**< Channel priority, XMC_DMA_CH_PRIORITY_4 and above get the fastest channels */
+  uint8_t src_peripheral_request;           /**< Source peripheral request, XMC_DMA_NO_PERIPHERAL_REQUEST if none */
+  uint8_t dst_peripheral_request;           /**< Destination peripheral request, XMC_DMA_NO_PERIPHERAL_REQUEST if none */
+  bool linked_list;                         /**< Linked list or scatter/gather support needed? */
+} XMC_DMA_CH_REQUIREMENTS_t;
+
+/**
+ * DMA channel allocation and mapping information
+ */
+typedef struct XMC_DMA_CH_INFO
+{
+  const char *owner;                        /**< Name of the user */
+  uint32_t bytes_per_second;                /**< Expected data rate */
+  XMC_DMA_CH_PRIORITY_t priority;           /**< Channel priority to configure */
+  uint8_t src_line;                         /**< Reserved source DLR line, XMC_DMA_NO_LINE if none */
+  uint8_t dst_line;                         /**< Reserved destination DLR line, XMC_DMA_NO_LINE if none */
+  uint8_t fifo_size;                        /**< Channel FIFO size in bytes */
+  bool linked_list;                         /**< Channel supports linked lists and scatter/gather? */
+  bool allocated;                           /**< Channel allocated? */
+  bool enabled;                             /**< Channel currently transferring? */
+} XMC_DMA_CH_INFO_t;
+
+/**
+ * DMA memory copy completion handler
+ */
+typedef void (*XMC_DMA_MEMCPY_HANDLER_t)(XMC_DMA_CH_STATUS_t status, void *context);
+
+/**
+ * DMA memory copy request
+ */
+typedef struct XMC_DMA_MEMCPY_REQUEST
+{
+  uint32_t dst_addr;                /**< Destination address */
+  uint32_t src_addr;                /**< Source address, unused for a fill */
+  uint32_t size;                    /**< Number of bytes */
+  XMC_DMA_MEMCPY_HANDLER_t handler; /**< Completion handler, optional */
+  void *context;                    /**< User context passed to the handler */
+  uint8_t value;                    /**< Fill value */
+  bool fill;                        /**< Fill or copy? */
+} XMC_DMA_MEMCPY_REQUEST_t;
+
+/**
+ * DMA memory copy engine state
+ */
+typedef struct XMC_DMA_MEMCPY
+{
+  XMC_DMA_t *dma;                     /**< GPDMA module of the reserved channel */
+  XMC_DMA_MEMCPY_REQUEST_t *requests; /**< Request queue storage */
+  XMC_DMA_LLI_t *chain;               /**< Linked list items for long transfers, NULL if not used */
+  uint32_t cpu_threshold;             /**< Requests smaller than this many bytes are copied by the CPU */
+  uint32_t offset;                    /**< Bytes of the oldest request already transferred */
+  uint32_t chunk;                     /**< Bytes transferred by the active channel program */
+  uint32_t fill_word;                 /**< Source word of a fill, the fill value in every byte */
+  uint8_t channel;                    /**< Reserved channel */
+  uint8_t chain_size;                 /**< Number of items in \a chain */
+  uint8_t size;                       /**< Number of queue entries, one is kept free */
+  uint8_t head;                       /**< Next entry to fill */
+  uint8_t tail;                       /**< Oldest entry, active if \a active is set */
+  bool active;                        /**< Transfer of the oldest entry in progress */
+} XMC_DMA_MEMCPY_t;
+
+/**
+ * DMA stream event handler
+ */
+typedef void (*XMC_DMA_STREAM_HANDLER_t)(uint32_t events, uint32_t segment, void *context);
+
+/**
+ * DMA stream configuration
+ */
+typedef struct XMC_DMA_STREAM_CONFIG
+{
+  void *buffer;                     /**< Ring buffer of \a num_segments segments, aligned to the memory side transfer width */
+  XMC_DMA_LLI_t *chain;             /**< One linked list item per segment, NULL for a single auto-reloaded segment */
+  XMC_DMA_STREAM_HANDLER_t handler; /**< Event handler, optional */
+  void *context;                    /**< User context passed to the handler */
+  uint16_t segment_size;            /**< Segment size in source transfer width units [1-2048] */
+  uint8_t num_segments;             /**< Number of segments, one without \a chain */
+} XMC_DMA_STREAM_CONFIG_t;
+
+/**
+ * DMA stream state
+ */
+typedef struct XMC_DMA_STREAM
+{
+  XMC_DMA_t *dma;                   /**< GPDMA module */
+  uint8_t *buffer;                  /**< Ring buffer */
+  XMC_DMA_LLI_t *chain;             /**< Linked list items, NULL in auto-reload mode */
+  XMC_DMA_STREAM_HANDLER_t handler; /**< Event handler */
+  void *context;                    /**< User context passed to the handler */
+  uint32_t segment_bytes;           /**< Segment size in bytes */
+  uint32_t overruns;                /**< Segments reached by the channel before they were released */
+  uint32_t request_overruns;        /**< Segments during which the DLR lost a peripheral request */
+  uint8_t channel;                  /**< Channel */
+  uint8_t num_segments;             /**< Number of segments */
+  uint8_t segment;                  /**< Segment in transfer */
+  uint8_t filled;                   /**< Completed segments not yet released */
+  uint8_t line;                     /**< DLR line of the peripheral request, XMC_DMA_STREAM_NO_LINE if none */
+  bool memory_is_dst;               /**< Peripheral to memory stream? */
+} XMC_DMA_STREAM_t;
+
+/**
+ * DMA linked list block, used to build a chain of ::XMC_DMA_LLI_t items
+ */
+typedef struct XMC_DMA_LLI_BLOCK
+{
+  uint32_t src_addr;   /**< Source address, aligned to the source transfer width */
+  uint32_t dst_addr;   /**< Destination address, aligned to the destination transfer width */
+  uint16_t block_size; /**< Block size in source transfer width units [1-2048] */
+} XMC_DMA_LLI_BLOCK_t;
+
 /*******************************************************************************
  * API PROTOTYPES
  *******************************************************************************/
@@ -711,6 +895,8 @@ void XMC_DMA_ClearOverrunStatus(XMC_DMA_t *const dma, const uint8_t line);
  * 1) In case the DMA channel is not enabled: ::XMC_DMA_CH_STATUS_BUSY        <br>
  * 2) If the GPDMA module itself is not enabled: ::XMC_DMA_CH_STATUS_ERROR    <br>
  * 3) If the configuration was successful: ::XMC_DMA_CH_STATUS_OK             <br>
+ * 4) If a DLR line of a hardware handshaking peripheral is reserved for
+ *    another channel by ::XMC_DMA_AllocateChannel(): ::XMC_DMA_CH_STATUS_BUSY <br>
  *
  * \par
  * Once the initialization is successful, calling ::XMC_DMA_CH_Enable() will trigger
@@ -718,6 +904,24 @@ void XMC_DMA_ClearOverrunStatus(XMC_DMA_t *const dma, const uint8_t line);
  */
 XMC_DMA_CH_STATUS_t XMC_DMA_CH_Init(XMC_DMA_t *const dma, const uint8_t channel, const XMC_DMA_CH_CONFIG_t *const config);
 
+#if defined(XMC_DMA_INSTRUMENTATION_ENABLE)
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @param channel The channel being enabled
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Record the enable time of a GPDMA channel <br>
+ *
+ * \par
+ * Called by ::XMC_DMA_CH_Enable(). The transfer complete event serviced by
+ * ::XMC_DMA_IRQHandler() then records the latency of the transfer. The block size
+ * is latched from the channel registers here, or from the linked list items if
+ * the channel runs a linked list.
+ */
+void XMC_DMA_CH_RecordEnable(XMC_DMA_t *const dma, const uint8_t channel);
+#endif
+
 /**
  * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
  * @param channel Which DMA channel should be enabled?
@@ -733,6 +937,9 @@ XMC_DMA_CH_STATUS_t XMC_DMA_CH_Init(XMC_DMA_t *const dma, const uint8_t channel,
  */
 __STATIC_INLINE void XMC_DMA_CH_Enable(XMC_DMA_t *const dma, const uint8_t channel)
 {
+#if defined(XMC_DMA_INSTRUMENTATION_ENABLE)
+  XMC_DMA_CH_RecordEnable(dma, channel);
+#endif
   dma->CHENREG = (uint32_t)(0x101UL << channel);   
 }
 
@@ -880,6 +1087,118 @@ __STATIC_INLINE void XMC_DMA_CH_SetLinkedListPointer(XMC_DMA_t *const dma, const
   dma->CH[channel].LLP = (uint32_t)ll_ptr;
 }
 
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @param channel A DMA channel
+ * @return XMC_DMA_LLI_t* Next linked list item to be fetched, NULL at the end of the chain
+ *
+ * \par<b>Description: </b><br>
+ * This function gets the linked list pointer<br>
+ *
+ * \par
+ * The channel loads the LLP register from each item it fetches. Called from a block
+ * transfer complete handler, the function tells which item of a chain follows the
+ * completed block.
+ */
+__STATIC_INLINE XMC_DMA_LLI_t *XMC_DMA_CH_GetLinkedListPointer(XMC_DMA_t *const dma, const uint8_t channel)
+{
+  return (XMC_DMA_LLI_t *)(dma->CH[channel].LLP & (uint32_t)GPDMA0_CH_LLP_LOC_Msk);
+}
+
+/**
+ * @param chain Linked list items to fill, word aligned
+ * @param blocks Source address, destination address and size of each block
+ * @param count Number of blocks, and of items in \a chain
+ * @param control Channel control word applied to every item, see ::XMC_DMA_CH_CONFIG_t
+ * @param loop Specify "true" to link the last item back to the first one, "false"
+ *             to end the transfer after the last block
+ * @return XMC_DMA_CH_STATUS_t ::XMC_DMA_CH_STATUS_OK, or ::XMC_DMA_CH_STATUS_ERROR if
+ *         the chain is invalid
+ *
+ * \par<b>Description: </b><br>
+ * Build a linked list chain in RAM <br>
+ *
+ * \par
+ * The function fills one item per block and links them in order, so a single
+ * channel program moves non-contiguous data without CPU intervention between blocks.
+ * The transfer widths, address count modes, burst lengths and transfer flow of
+ * \a control apply to all items. If the interrupt enable bit is set, a block transfer
+ * complete event is raised after every block.
+ *
+ * \par
+ * The built chain is checked with ::XMC_DMA_LLI_ValidateChain(). It must not be
+ * used if the function returns an error.
+ *
+ * \par<b>Related API: </b><br>
+ * ::XMC_DMA_CH_InitLinkedList(), ::XMC_DMA_LLI_EndChain() <br>
+ */
+XMC_DMA_CH_STATUS_t XMC_DMA_LLI_BuildChain(XMC_DMA_LLI_t *const chain,
+                                           const XMC_DMA_LLI_BLOCK_t *const blocks,
+                                           const uint32_t count,
+                                           const uint32_t control,
+                                           const bool loop);
+
+/**
+ * @param head First item of the chain
+ * @param max_items Maximum number of items expected in the chain
+ * @return XMC_DMA_CH_STATUS_t ::XMC_DMA_CH_STATUS_OK, or ::XMC_DMA_CH_STATUS_ERROR if
+ *         the chain is invalid
+ *
+ * \par<b>Description: </b><br>
+ * Validate a linked list chain <br>
+ *
+ * \par
+ * The function walks the chain from \a head and checks every item: it must be word
+ * aligned, its block size must be in the range [1-2048], its transfer widths must
+ * be supported and its addresses aligned to them, and its linked list enable bits
+ * must be set if and only if it links to a next item. The chain must end, or link
+ * back to \a head, within \a max_items items.
+ */
+XMC_DMA_CH_STATUS_t XMC_DMA_LLI_ValidateChain(const XMC_DMA_LLI_t *const head, const uint32_t max_items);
+
+/**
+ * @param item The item after which the transfer ends
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * End a linked list chain <br>
+ *
+ * \par
+ * The function clears the linked list pointer and enable bits of an item. Used on
+ * the last item of a looping chain, the transfer ends after that block, once the
+ * channel fetches the item again. An item already fetched by the channel is not
+ * affected until its next pass.
+ */
+void XMC_DMA_LLI_EndChain(XMC_DMA_LLI_t *const item);
+
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @param channel The GPDMA channel (number) which needs to be initialized
+ * @param config A constant pointer to ::XMC_DMA_CH_CONFIG_t, pointing to a const
+ *               channel configuration
+ * @param chain First item of a linked list chain
+ * @return XMC_DMA_CH_STATUS_t Initialization status
+ *
+ * \par<b>Description: </b><br>
+ * Initialize a GPDMA channel for a linked list multi-block transfer <br>
+ *
+ * \par
+ * The function initializes the channel with ::XMC_DMA_CH_Init() using \a config,
+ * with the addresses and block size of the first item, \a chain as linked list
+ * pointer and source and destination linked list transfer type. The control word,
+ * addresses and size of every block are then loaded from the chain. Only GPDMA0
+ * channels 0 and 1 support linked lists, other channels return
+ * ::XMC_DMA_CH_STATUS_ERROR.
+ *
+ * \par
+ * Once the initialization is successful, calling ::XMC_DMA_CH_Enable() will start
+ * the transfer.
+ */
+XMC_DMA_CH_STATUS_t XMC_DMA_CH_InitLinkedList(XMC_DMA_t *const dma,
+                                              const uint8_t channel,
+                                              const XMC_DMA_CH_CONFIG_t *const config,
+                                              XMC_DMA_LLI_t *const chain);
+
 /**
  * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
  * @param channel Which DMA channel should be checked for a suspended transfer?
@@ -1203,6 +1522,75 @@ void XMC_DMA_CH_RequestLastMultiblockTransfer(XMC_DMA_t *const dma, const uint8_
  */
 void XMC_DMA_CH_SetEventHandler(XMC_DMA_t *const dma, const uint8_t channel, XMC_DMA_CH_EVENT_HANDLER_t event_handler);
 
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @param channel The channel for which the event handler is being registered
+ * @param event_handler The event handler which will be invoked when the DMA event
+ *                      occurs
+ * @param context User context passed to \a event_handler
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Set a GPDMA event handler with user context to service GPDMA events <br>
+ *
+ * \par
+ * The function replaces a handler registered with ::XMC_DMA_CH_SetEventHandler().
+ * One handler function can then serve several channels, telling them apart by
+ * \a context.
+ */
+void XMC_DMA_CH_SetEventHandlerContext(XMC_DMA_t *const dma,
+                                       const uint8_t channel,
+                                       XMC_DMA_CH_EVENT_CONTEXT_HANDLER_t event_handler,
+                                       void *const context);
+
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @param channel The channel for which the event counters are requested
+ * @param counters Filled with the number of events of each type
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Get GPDMA channel event counters <br>
+ *
+ * \par
+ * ::XMC_DMA_IRQHandler() counts every event it services, whether or not a handler
+ * is registered. Together with ::XMC_DMA_GetInterruptCount() the counters show the
+ * interrupt load generated by each channel.
+ */
+void XMC_DMA_CH_GetEventCounters(XMC_DMA_t *const dma, const uint8_t channel, XMC_DMA_CH_EVENT_COUNTERS_t *const counters);
+
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @param channel The channel for which the event counters must be cleared
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Clear GPDMA channel event counters <br>
+ */
+void XMC_DMA_CH_ClearEventCounters(XMC_DMA_t *const dma, const uint8_t channel);
+
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @return uint32_t Number of ::XMC_DMA_IRQHandler() calls
+ *
+ * \par<b>Description: </b><br>
+ * Get the number of GPDMA interrupts serviced <br>
+ *
+ * \par
+ * Compared to the sum of the channel event counters, the value shows how many
+ * events each interrupt entry serviced.
+ */
+uint32_t XMC_DMA_GetInterruptCount(XMC_DMA_t *const dma);
+
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Clear the number of GPDMA interrupts serviced <br>
+ */
+void XMC_DMA_ClearInterruptCount(XMC_DMA_t *const dma);
+
 /**
  * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
  * @param channel The source peripheral request for which DMA channel is to be cleared?
@@ -1246,10 +1634,343 @@ void XMC_DMA_CH_ClearDestinationPeripheralRequest(XMC_DMA_t *const dma, uint8_t
  *
  * The function handles the enabled GPDMA events and runs the user callback function
  * registered by the user to service the event. To register a callback function,
- * see ::XMC_DMA_CH_SetEventHandler()
+ * see ::XMC_DMA_CH_SetEventHandler() or ::XMC_DMA_CH_SetEventHandlerContext()
+ *
+ * \par
+ * All pending events of all channels are serviced in one call, in the order error,
+ * transfer complete, block transfer complete, source and destination transaction
+ * complete. Within each event type, channels are serviced from the highest to the
+ * lowest channel number. An event is cleared before its callback runs, so the
+ * callback may restart the channel without losing the next event.
  */
 void XMC_DMA_IRQHandler(XMC_DMA_t *const dma);
 
+#if defined(XMC_DMA_INSTRUMENTATION_ENABLE)
+/**
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Start the DWT cycle counter used by the GPDMA instrumentation <br>
+ *
+ * \par
+ * The instrumentation is compiled in if XMC_DMA_INSTRUMENTATION_ENABLE is defined.
+ * It time stamps every channel enable and transfer completion with the DWT cycle
+ * counter, and counts the bytes moved by completed blocks and the DMA errors of
+ * each channel. Completions and errors are recorded by ::XMC_DMA_IRQHandler(), so
+ * the transfer complete and error events must be enabled. Blocks of a multi-block
+ * transfer are counted if the block transfer complete event is enabled, otherwise
+ * only the last block is.
+ */
+void XMC_DMA_InitInstrumentation(void);
+
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @param snapshot Filled with the statistics of all channels of the module
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Take a consistent snapshot of the GPDMA instrumentation <br>
+ *
+ * \par
+ * The statistics of all channels are copied with interrupts disabled. The busy
+ * cycles of a channel relative to \a elapsed give its share of the bus time; the
+ * bytes and latency histogram show which stream waits for the bus.
+ */
+void XMC_DMA_GetInstrumentationSnapshot(XMC_DMA_t *const dma, XMC_DMA_INSTRUMENTATION_SNAPSHOT_t *const snapshot);
+
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Clear the GPDMA instrumentation statistics of all channels of a module <br>
+ */
+void XMC_DMA_ClearInstrumentation(XMC_DMA_t *const dma);
+#endif
+
+/**
+ * @param requirements What the channel must support
+ * @param dma Set to the module of the allocated channel
+ * @param channel Set to the allocated channel
+ * @return XMC_DMA_CH_STATUS_t ::XMC_DMA_CH_STATUS_OK, ::XMC_DMA_CH_STATUS_BUSY if no
+ *         suitable channel is free or a DLR line is reserved by another channel, or
+ *         ::XMC_DMA_CH_STATUS_ERROR if the requirements cannot be met by any channel
+ *
+ * \par<b>Description: </b><br>
+ * Allocate a GPDMA channel and its DLR lines at runtime <br>
+ *
+ * \par
+ * Drivers allocate their channels instead of hardcoding them, so that collisions
+ * show up as an error at initialization. A channel is suitable if a burst of the
+ * requested length and width fits its FIFO, and if it supports linked lists when
+ * required (GPDMA0 channels 0 and 1). The DLR lines of the peripheral requests
+ * are reserved for the channel; they are enabled by ::XMC_DMA_CH_Init().
+ *
+ * \par
+ * Requirements with priority ::XMC_DMA_CH_PRIORITY_4 or above get the lowest
+ * numbered suitable channel of GPDMA0, which wins arbitration among equal
+ * priorities and has the largest FIFO. Lower priorities get the highest numbered
+ * suitable channel, starting with GPDMA1, so the fast channels stay free. The
+ * caller configures the channel with the requested priority.
+ */
+XMC_DMA_CH_STATUS_t XMC_DMA_AllocateChannel(const XMC_DMA_CH_REQUIREMENTS_t *const requirements,
+                                            XMC_DMA_t **const dma,
+                                            uint8_t *const channel);
+
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @param channel The channel to free
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Free an allocated GPDMA channel and its DLR lines <br>
+ *
+ * \par
+ * The channel must be disabled. The DLR lines are disabled and released.
+ */
+void XMC_DMA_FreeChannel(XMC_DMA_t *const dma, const uint8_t channel);
+
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @param channel The channel for which the information is requested
+ * @param info Filled with the allocation and capabilities of the channel
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Get the allocation of a GPDMA channel <br>
+ *
+ * \par
+ * Called for every channel of both modules, the function reports the complete
+ * channel and DLR line mapping with the expected load of each channel. See
+ * ::XMC_DMA_CH_GetEventCounters() for the measured number of transfers.
+ */
+void XMC_DMA_CH_GetInfo(XMC_DMA_t *const dma, const uint8_t channel, XMC_DMA_CH_INFO_t *const info);
+
+/**
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @return uint32_t Sum of the expected data rates of the allocated channels
+ *
+ * \par<b>Description: </b><br>
+ * Get the expected load of a GPDMA module in bytes per second <br>
+ */
+uint32_t XMC_DMA_GetAllocatedLoad(XMC_DMA_t *const dma);
+
+/**
+ * @param engine Memory copy engine state
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @param channel Channel reserved for the engine
+ * @param requests Request queue storage
+ * @param size Number of entries in \a requests, at least two
+ * @param chain Linked list items for long transfers, NULL to use single blocks
+ * @param chain_size Number of items in \a chain
+ * @param cpu_threshold Requests smaller than this many bytes are copied by the CPU
+ * @return XMC_DMA_CH_STATUS_t ::XMC_DMA_CH_STATUS_OK, or ::XMC_DMA_CH_STATUS_ERROR if
+ *         the GPDMA module is not enabled or \a chain is given for a channel without
+ *         linked list support
+ *
+ * \par<b>Description: </b><br>
+ * Initialize the DMA memory copy engine <br>
+ *
+ * \par
+ * The engine runs memory to memory copies and fills on a reserved channel, so the
+ * CPU keeps running while bulk data moves between SRAM banks or external memory.
+ * Requests are queued and run in order, one at a time. A single channel program
+ * moves up to 2048 transfers; with \a chain, GPDMA0 channels 0 and 1 move up to
+ * \a chain_size blocks per program. Longer requests are split into several programs.
+ *
+ * \par
+ * The function registers the engine's handler for the channel with
+ * ::XMC_DMA_CH_SetEventHandlerContext() and enables the transfer complete and error
+ * events. The GPDMA interrupt must be enabled in the NVIC and call
+ * ::XMC_DMA_IRQHandler().
+ */
+XMC_DMA_CH_STATUS_t XMC_DMA_MEMCPY_Init(XMC_DMA_MEMCPY_t *const engine,
+                                        XMC_DMA_t *const dma,
+                                        const uint8_t channel,
+                                        XMC_DMA_MEMCPY_REQUEST_t *const requests,
+                                        const uint8_t size,
+                                        XMC_DMA_LLI_t *const chain,
+                                        const uint8_t chain_size,
+                                        const uint32_t cpu_threshold);
+
+/**
+ * @param engine Memory copy engine state
+ * @param dst Destination buffer
+ * @param src Source buffer
+ * @param size Number of bytes
+ * @param handler Called on completion, may be NULL
+ * @param context User context passed to \a handler
+ * @return XMC_DMA_CH_STATUS_t ::XMC_DMA_CH_STATUS_OK, or ::XMC_DMA_CH_STATUS_BUSY if
+ *         the queue is full
+ *
+ * \par<b>Description: </b><br>
+ * Queue a memory copy <br>
+ *
+ * \par
+ * The transfer width is the widest one to which both buffers are aligned, so word
+ * aligned buffers are copied a word at a time whatever \a size is; the last one to
+ * three bytes that do not fill a transfer are copied by the CPU in the completion
+ * event. A request shorter than one transfer is copied bytewise. A request below the
+ * CPU threshold is copied with memcpy() when its turn comes; if the engine is idle
+ * this happens before the function returns, and \a handler runs in the caller's
+ * context. Otherwise \a handler runs in the GPDMA interrupt. The buffers must not
+ * overlap.
+ */
+XMC_DMA_CH_STATUS_t XMC_DMA_MEMCPY_Copy(XMC_DMA_MEMCPY_t *const engine,
+                                        void *const dst,
+                                        const void *const src,
+                                        const uint32_t size,
+                                        XMC_DMA_MEMCPY_HANDLER_t handler,
+                                        void *const context);
+
+/**
+ * @param engine Memory copy engine state
+ * @param dst Destination buffer
+ * @param value Fill value
+ * @param size Number of bytes
+ * @param handler Called on completion, may be NULL
+ * @param context User context passed to \a handler
+ * @return XMC_DMA_CH_STATUS_t ::XMC_DMA_CH_STATUS_OK, or ::XMC_DMA_CH_STATUS_BUSY if
+ *         the queue is full
+ *
+ * \par<b>Description: </b><br>
+ * Queue a memory fill <br>
+ *
+ * \par
+ * The channel reads a word holding \a value in every byte from a fixed address.
+ * Otherwise the request is handled like ::XMC_DMA_MEMCPY_Copy(), with memset()
+ * below the CPU threshold.
+ */
+XMC_DMA_CH_STATUS_t XMC_DMA_MEMCPY_Fill(XMC_DMA_MEMCPY_t *const engine,
+                                        void *const dst,
+                                        const uint8_t value,
+                                        const uint32_t size,
+                                        XMC_DMA_MEMCPY_HANDLER_t handler,
+                                        void *const context);
+
+/**
+ * @param engine Memory copy engine state
+ * @param cpu_threshold Requests smaller than this many bytes are copied by the CPU
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Set the CPU copy threshold <br>
+ *
+ * \par
+ * Below a few dozen bytes, programming the channel and taking the completion
+ * interrupt costs more than copying. The threshold applies to requests started
+ * after the call.
+ */
+__STATIC_INLINE void XMC_DMA_MEMCPY_SetThreshold(XMC_DMA_MEMCPY_t *const engine, const uint32_t cpu_threshold)
+{
+  engine->cpu_threshold = cpu_threshold;
+}
+
+/**
+ * @param engine Memory copy engine state
+ * @return bool "true" if requests are pending, "false" otherwise
+ *
+ * \par<b>Description: </b><br>
+ * Check if the DMA memory copy engine is busy <br>
+ */
+__STATIC_INLINE bool XMC_DMA_MEMCPY_IsBusy(const XMC_DMA_MEMCPY_t *const engine)
+{
+  return (engine->head != engine->tail);
+}
+
+/**
+ * @param stream Stream state
+ * @param dma A constant pointer to XMC_DMA_t, pointing to the GPDMA base address
+ * @param channel The GPDMA channel (number) used by the stream
+ * @param config A constant pointer to ::XMC_DMA_CH_CONFIG_t, pointing to a const
+ *               channel configuration for the peripheral side
+ * @param stream_config Buffer, segment layout and handler of the stream
+ * @return XMC_DMA_CH_STATUS_t Initialization status
+ *
+ * \par<b>Description: </b><br>
+ * Initialize a continuous DMA stream between a peripheral and a ring buffer <br>
+ *
+ * \par
+ * \a config describes the peripheral side as for ::XMC_DMA_CH_Init(): transfer
+ * flow, widths, burst lengths, priority, handshaking and the peripheral address in
+ * \a src_addr (peripheral to memory) or \a dst_addr (memory to peripheral). The
+ * memory address, block size and transfer type are set by the stream.
+ *
+ * \par
+ * Streams run on GPDMA0 channels 0 and 1 only, the other channels have neither
+ * linked lists nor address reload. With a linked list chain the ring has
+ * \a num_segments segments, e.g. two for double buffering. The chain loops over
+ * them, so the channel moves from one segment to the next without a gap. Without a
+ * chain, the ring is a single segment whose memory address is auto-reloaded at the
+ * end of every block.
+ *
+ * \par
+ * A segment complete event is raised after every segment, with the half and full
+ * complete events on the middle and last segments. If several segments completed
+ * before the interrupt was serviced, the completed segments are derived from the
+ * channel position and the handler is called once for each of them. Release each segment with
+ * ::XMC_DMA_STREAM_Release() once it has been processed; with more than one
+ * segment, reaching an unreleased segment raises an overrun. A request overrun is raised if the DLR line of a
+ * hardware handshaking peripheral reports an overrun, see
+ * ::XMC_DMA_GetOverrunStatus().
+ *
+ * \par
+ * The function returns ::XMC_DMA_CH_STATUS_ERROR for an invalid stream
+ * configuration, a channel other than GPDMA0 channel 0 or 1, or a transfer flow
+ * that is neither peripheral to memory nor memory to peripheral, else the status
+ * of the channel initialization.
+ */
+XMC_DMA_CH_STATUS_t XMC_DMA_STREAM_Init(XMC_DMA_STREAM_t *const stream,
+                                        XMC_DMA_t *const dma,
+                                        const uint8_t channel,
+                                        const XMC_DMA_CH_CONFIG_t *const config,
+                                        const XMC_DMA_STREAM_CONFIG_t *const stream_config);
+
+/**
+ * @param stream Stream state
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Start a DMA stream at the first segment <br>
+ */
+void XMC_DMA_STREAM_Start(XMC_DMA_STREAM_t *const stream);
+
+/**
+ * @param stream Stream state
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Stop a DMA stream <br>
+ *
+ * \par
+ * The function disables the channel. Call ::XMC_DMA_STREAM_Init() again before
+ * restarting a linked list stream, so that the channel reloads the first item.
+ */
+void XMC_DMA_STREAM_Stop(XMC_DMA_STREAM_t *const stream);
+
+/**
+ * @param stream Stream state
+ * @param count Number of segments processed since the last call
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Release processed segments to the channel <br>
+ */
+void XMC_DMA_STREAM_Release(XMC_DMA_STREAM_t *const stream, const uint32_t count);
+
+/**
+ * @param stream Stream state
+ * @return uint32_t Offset in bytes of the next memory access of the channel
+ *
+ * \par<b>Description: </b><br>
+ * Get the fill position of a DMA stream <br>
+ *
+ * \par
+ * The function reads the memory side address register of the channel, so that
+ * the data received so far can be processed before the segment completes.
+ */
+uint32_t XMC_DMA_STREAM_GetPosition(const XMC_DMA_STREAM_t *const stream);
+
 #ifdef __cplusplus
 }
 #endif
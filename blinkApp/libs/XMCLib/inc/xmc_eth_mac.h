@@ -100,14 +100,37 @@ typedef enum XMC_ETH_MAC_STATUS
 
 /**
  * Transmission frame
+ *
+ * The checksum modes are mutually exclusive. Without any of them the MAC inserts the
+ * IP header checksum and the TCP/UDP/ICMP checksum including the pseudo-header.
  */
 typedef enum XMC_ETH_MAC_TX_FRAME
 {
   XMC_ETH_MAC_TX_FRAME_FRAGMENT  = 0x1U, /**< Indicate frame fragment */
   XMC_ETH_MAC_TX_FRAME_EVENT     = 0x2U, /**< Generate event when frame is transmitted */
-  XMC_ETH_MAC_TX_FRAME_TIMESTAMP = 0x4U  /**< Capture frame time stamp */
+  XMC_ETH_MAC_TX_FRAME_TIMESTAMP = 0x4U, /**< Capture frame time stamp */
+  XMC_ETH_MAC_TX_FRAME_CHECKSUM_IP_HEADER  = 0x10U, /**< Insert the IPv4 header checksum only */
+  XMC_ETH_MAC_TX_FRAME_CHECKSUM_IP_PAYLOAD = 0x20U, /**< Insert IPv4 header and payload checksum,
+                                                         the pseudo-header checksum is provided by software */
+  XMC_ETH_MAC_TX_FRAME_CHECKSUM_DISABLE    = 0x30U  /**< No checksum insertion */
 } XMC_ETH_MAC_TX_FRAME_t;
 
+/**
+ * Receive checksum offload status, see XMC_ETH_MAC_GetRxChecksumStatus()
+ */
+typedef enum XMC_ETH_MAC_RX_CHECKSUM
+{
+  XMC_ETH_MAC_RX_CHECKSUM_PAYLOAD_UDP     = 0x01U, /**< IP payload type is UDP */
+  XMC_ETH_MAC_RX_CHECKSUM_PAYLOAD_TCP     = 0x02U, /**< IP payload type is TCP */
+  XMC_ETH_MAC_RX_CHECKSUM_PAYLOAD_ICMP    = 0x03U, /**< IP payload type is ICMP */
+  XMC_ETH_MAC_RX_CHECKSUM_PAYLOAD_TYPE    = 0x07U, /**< Mask of the IP payload type */
+  XMC_ETH_MAC_RX_CHECKSUM_IP_HEADER_ERROR = 0x08U, /**< IP header checksum error */
+  XMC_ETH_MAC_RX_CHECKSUM_PAYLOAD_ERROR   = 0x10U, /**< TCP/UDP/ICMP checksum error */
+  XMC_ETH_MAC_RX_CHECKSUM_BYPASSED        = 0x20U, /**< Checksum offload engine bypassed */
+  XMC_ETH_MAC_RX_CHECKSUM_IPV4            = 0x40U, /**< IPv4 frame */
+  XMC_ETH_MAC_RX_CHECKSUM_IPV6            = 0x80U  /**< IPv6 frame */
+} XMC_ETH_MAC_RX_CHECKSUM_t;
+
 /**
  * ETH MAC event
  */
@@ -205,6 +228,94 @@ typedef enum XMC_ETH_MAC_TIMESTAMP_CONFIG
   XMC_ETH_MAC_TIMESTAMP_CONFIG_ENABLE_MAC_ADDRESS_FILTER = ETH_TIMESTAMP_CONTROL_TSENMACADDR_Msk /**< MAC address filter */
 } XMC_ETH_MAC_TIMESTAMP_CONFIG_t;
 
+/**
+ * MAC management counters, in register order
+ */
+typedef enum XMC_ETH_MAC_MMC_COUNTER
+{
+  XMC_ETH_MAC_MMC_COUNTER_TX_OCTETS_GOOD_BAD = 0U,            /**< Transmitted octets, good and bad frames */
+  XMC_ETH_MAC_MMC_COUNTER_TX_FRAMES_GOOD_BAD,                 /**< Transmitted frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_TX_BROADCAST_FRAMES_GOOD,           /**< Transmitted good broadcast frames */
+  XMC_ETH_MAC_MMC_COUNTER_TX_MULTICAST_FRAMES_GOOD,           /**< Transmitted good multicast frames */
+  XMC_ETH_MAC_MMC_COUNTER_TX_64_OCTETS_FRAMES,                /**< Transmitted 64 byte frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_TX_65_TO_127_OCTETS_FRAMES,         /**< Transmitted 65 to 127 byte frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_TX_128_TO_255_OCTETS_FRAMES,        /**< Transmitted 128 to 255 byte frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_TX_256_TO_511_OCTETS_FRAMES,        /**< Transmitted 256 to 511 byte frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_TX_512_TO_1023_OCTETS_FRAMES,       /**< Transmitted 512 to 1023 byte frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_TX_1024_TO_MAX_OCTETS_FRAMES,       /**< Transmitted 1024 byte or larger frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_TX_UNICAST_FRAMES_GOOD_BAD,         /**< Transmitted unicast frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_TX_MULTICAST_FRAMES_GOOD_BAD,       /**< Transmitted multicast frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_TX_BROADCAST_FRAMES_GOOD_BAD,       /**< Transmitted broadcast frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_TX_UNDERFLOW_ERROR_FRAMES,          /**< Frames aborted on transmit FIFO underflow */
+  XMC_ETH_MAC_MMC_COUNTER_TX_SINGLE_COLLISION_FRAMES,         /**< Frames transmitted after a single collision */
+  XMC_ETH_MAC_MMC_COUNTER_TX_MULTIPLE_COLLISION_FRAMES,       /**< Frames transmitted after multiple collisions */
+  XMC_ETH_MAC_MMC_COUNTER_TX_DEFERRED_FRAMES,                 /**< Frames transmitted after deferral */
+  XMC_ETH_MAC_MMC_COUNTER_TX_LATE_COLLISION_FRAMES,           /**< Frames aborted on late collision */
+  XMC_ETH_MAC_MMC_COUNTER_TX_EXCESSIVE_COLLISION_FRAMES,      /**< Frames aborted on excessive collisions */
+  XMC_ETH_MAC_MMC_COUNTER_TX_CARRIER_ERROR_FRAMES,            /**< Frames aborted on carrier sense error */
+  XMC_ETH_MAC_MMC_COUNTER_TX_OCTETS_GOOD,                     /**< Transmitted octets, good frames */
+  XMC_ETH_MAC_MMC_COUNTER_TX_FRAMES_GOOD,                     /**< Transmitted good frames */
+  XMC_ETH_MAC_MMC_COUNTER_TX_EXCESSIVE_DEFERRAL_FRAMES,       /**< Frames aborted on excessive deferral */
+  XMC_ETH_MAC_MMC_COUNTER_TX_PAUSE_FRAMES,                    /**< Transmitted good pause frames */
+  XMC_ETH_MAC_MMC_COUNTER_TX_VLAN_FRAMES_GOOD,                /**< Transmitted good VLAN frames */
+  XMC_ETH_MAC_MMC_COUNTER_TX_OVERSIZE_FRAMES_GOOD,            /**< Transmitted good oversize frames */
+  XMC_ETH_MAC_MMC_COUNTER_RX_FRAMES_GOOD_BAD,                 /**< Received frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_RX_OCTETS_GOOD_BAD,                 /**< Received octets, good and bad frames */
+  XMC_ETH_MAC_MMC_COUNTER_RX_OCTETS_GOOD,                     /**< Received octets, good frames */
+  XMC_ETH_MAC_MMC_COUNTER_RX_BROADCAST_FRAMES_GOOD,           /**< Received good broadcast frames */
+  XMC_ETH_MAC_MMC_COUNTER_RX_MULTICAST_FRAMES_GOOD,           /**< Received good multicast frames */
+  XMC_ETH_MAC_MMC_COUNTER_RX_CRC_ERROR_FRAMES,                /**< Received frames with CRC error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_ALIGNMENT_ERROR_FRAMES,          /**< Received frames with alignment error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_RUNT_ERROR_FRAMES,               /**< Received runt frames */
+  XMC_ETH_MAC_MMC_COUNTER_RX_JABBER_ERROR_FRAMES,             /**< Received jabber frames */
+  XMC_ETH_MAC_MMC_COUNTER_RX_UNDERSIZE_FRAMES_GOOD,           /**< Received undersize frames without error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_OVERSIZE_FRAMES_GOOD,            /**< Received oversize frames without error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_64_OCTETS_FRAMES,                /**< Received 64 byte frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_RX_65_TO_127_OCTETS_FRAMES,         /**< Received 65 to 127 byte frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_RX_128_TO_255_OCTETS_FRAMES,        /**< Received 128 to 255 byte frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_RX_256_TO_511_OCTETS_FRAMES,        /**< Received 256 to 511 byte frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_RX_512_TO_1023_OCTETS_FRAMES,       /**< Received 512 to 1023 byte frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_RX_1024_TO_MAX_OCTETS_FRAMES,       /**< Received 1024 byte or larger frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_RX_UNICAST_FRAMES_GOOD,             /**< Received good unicast frames */
+  XMC_ETH_MAC_MMC_COUNTER_RX_LENGTH_ERROR_FRAMES,             /**< Received frames with length field error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_OUT_OF_RANGE_TYPE_FRAMES,        /**< Received frames with out of range length field */
+  XMC_ETH_MAC_MMC_COUNTER_RX_PAUSE_FRAMES,                    /**< Received good pause frames */
+  XMC_ETH_MAC_MMC_COUNTER_RX_FIFO_OVERFLOW_FRAMES,            /**< Frames dropped on receive FIFO overflow */
+  XMC_ETH_MAC_MMC_COUNTER_RX_VLAN_FRAMES_GOOD_BAD,            /**< Received VLAN frames, good and bad */
+  XMC_ETH_MAC_MMC_COUNTER_RX_WATCHDOG_ERROR_FRAMES,           /**< Received frames with watchdog timeout error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_RECEIVE_ERROR_FRAMES,            /**< Received frames with receive error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_CONTROL_FRAMES_GOOD,             /**< Received good control frames */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV4_GOOD_FRAMES,                /**< Received good IPv4 datagrams */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV4_HEADER_ERROR_FRAMES,        /**< Received IPv4 datagrams with header error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV4_NO_PAYLOAD_FRAMES,          /**< Received IPv4 datagrams without TCP, UDP or ICMP payload */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV4_FRAGMENTED_FRAMES,          /**< Received fragmented IPv4 datagrams */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV4_UDP_CHECKSUM_DISABLED_FRAMES, /**< Received IPv4 UDP datagrams without checksum */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV6_GOOD_FRAMES,                /**< Received good IPv6 datagrams */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV6_HEADER_ERROR_FRAMES,        /**< Received IPv6 datagrams with header error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV6_NO_PAYLOAD_FRAMES,          /**< Received IPv6 datagrams without TCP, UDP or ICMP payload */
+  XMC_ETH_MAC_MMC_COUNTER_RX_UDP_GOOD_FRAMES,                 /**< Received good UDP segments */
+  XMC_ETH_MAC_MMC_COUNTER_RX_UDP_ERROR_FRAMES,                /**< Received UDP segments with checksum error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_TCP_GOOD_FRAMES,                 /**< Received good TCP segments */
+  XMC_ETH_MAC_MMC_COUNTER_RX_TCP_ERROR_FRAMES,                /**< Received TCP segments with checksum error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_ICMP_GOOD_FRAMES,                /**< Received good ICMP segments */
+  XMC_ETH_MAC_MMC_COUNTER_RX_ICMP_ERROR_FRAMES,               /**< Received ICMP segments with checksum error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV4_GOOD_OCTETS,                /**< Octets of good IPv4 datagrams */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV4_HEADER_ERROR_OCTETS,        /**< Octets of IPv4 datagrams with header error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV4_NO_PAYLOAD_OCTETS,          /**< Octets of IPv4 datagrams without TCP, UDP or ICMP payload */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV4_FRAGMENTED_OCTETS,          /**< Octets of fragmented IPv4 datagrams */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV4_UDP_CHECKSUM_DISABLED_OCTETS, /**< Octets of IPv4 UDP datagrams without checksum */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV6_GOOD_OCTETS,                /**< Octets of good IPv6 datagrams */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV6_HEADER_ERROR_OCTETS,        /**< Octets of IPv6 datagrams with header error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_IPV6_NO_PAYLOAD_OCTETS,          /**< Octets of IPv6 datagrams without TCP, UDP or ICMP payload */
+  XMC_ETH_MAC_MMC_COUNTER_RX_UDP_GOOD_OCTETS,                 /**< Octets of good UDP segments */
+  XMC_ETH_MAC_MMC_COUNTER_RX_UDP_ERROR_OCTETS,                /**< Octets of UDP segments with checksum error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_TCP_GOOD_OCTETS,                 /**< Octets of good TCP segments */
+  XMC_ETH_MAC_MMC_COUNTER_RX_TCP_ERROR_OCTETS,                /**< Octets of TCP segments with checksum error */
+  XMC_ETH_MAC_MMC_COUNTER_RX_ICMP_GOOD_OCTETS,                /**< Octets of good ICMP segments */
+  XMC_ETH_MAC_MMC_COUNTER_RX_ICMP_ERROR_OCTETS,               /**< Octets of ICMP segments with checksum error */
+  XMC_ETH_MAC_MMC_COUNTER_NUM                                 /**< Number of MAC management counters */
+} XMC_ETH_MAC_MMC_COUNTER_t;
+
 /**********************************************************************************************************************
  * DATA STRUCTURES
  *********************************************************************************************************************/
@@ -255,7 +366,7 @@ typedef struct XMC_ETH_MAC_DMA_DESC
   uint32_t buffer1;                /**< Buffer 1 */
   uint32_t buffer2;                /**< Buffer 2 */
   uint32_t extended_status;        /**< Extended status */
-  uint32_t reserved;               /**< Reserved */
+  uint32_t reserved;               /**< Reserved (TX: completion context of a zero-copy frame) */
   uint32_t time_stamp_seconds;     /**< Time stamp low */
   uint32_t time_stamp_nanoseconds; /**< Time stamp high */
 } XMC_ETH_MAC_DMA_DESC_t;
@@ -269,6 +380,222 @@ typedef struct XMC_ETH_MAC_TIME
   uint32_t seconds;
 } XMC_ETH_MAC_TIME_t;
 
+/**
+ * ETH MAC adaptive interrupt coalescing configuration
+ */
+typedef struct XMC_ETH_MAC_COALESCE_CONFIG
+{
+  uint16_t rate_low;       /**< Frames per update interval up to which every frame raises an interrupt */
+  uint16_t rate_high;      /**< Frames per update interval from which the maximum coalescing is used */
+  uint8_t rx_watchdog_max; /**< Maximum receive interrupt watchdog, in units of 256 system clock cycles */
+  uint8_t tx_frames_max;   /**< Maximum number of transmitted frames per transmit interrupt */
+} XMC_ETH_MAC_COALESCE_CONFIG_t;
+
+/**
+ * ETH MAC received frame lent to the application by XMC_ETH_MAC_BorrowRxFrame()
+ */
+typedef struct XMC_ETH_MAC_RX_FRAME
+{
+  uint8_t *buffer; /**< Frame data, owned by the application until XMC_ETH_MAC_ReturnRxFrame() */
+  uint32_t length; /**< Frame length (CRC excluded) */
+  uint32_t checksum_status; /**< Checksum offload status, ored combination of ::XMC_ETH_MAC_RX_CHECKSUM_t */
+} XMC_ETH_MAC_RX_FRAME_t;
+
+/**
+ * ETH MAC receive frame handler, called by XMC_ETH_MAC_ReadFrames() for each frame held in a DMA buffer
+ */
+typedef void (*XMC_ETH_MAC_RX_FRAME_HANDLER_t)(const uint8_t *frame, uint32_t len, void *context);
+
+/**
+ * ETH MAC transmit fragment, one element of the list passed to XMC_ETH_MAC_SendFrameScatter()
+ */
+typedef struct XMC_ETH_MAC_TX_FRAGMENT
+{
+  const uint8_t *buffer; /**< Fragment data, must stay valid until the frame is transmitted */
+  uint32_t length;       /**< Fragment length. \b Range: 1 to 8191 */
+} XMC_ETH_MAC_TX_FRAGMENT_t;
+
+/**
+ * ETH MAC zero-copy transmit completion handler, called with the context passed to XMC_ETH_MAC_SendFrameScatter()
+ */
+typedef void (*XMC_ETH_MAC_TX_DONE_HANDLER_t)(void *context);
+
+/**
+ * ETH MAC time stamp source
+ */
+typedef enum XMC_ETH_MAC_TIMESTAMP_SOURCE
+{
+  XMC_ETH_MAC_TIMESTAMP_SOURCE_RX, /**< Time stamp of a received frame */
+  XMC_ETH_MAC_TIMESTAMP_SOURCE_TX  /**< Time stamp of a transmitted frame */
+} XMC_ETH_MAC_TIMESTAMP_SOURCE_t;
+
+/**
+ * ETH MAC per-frame time stamp
+ */
+typedef struct XMC_ETH_MAC_TIMESTAMP
+{
+  XMC_ETH_MAC_TIME_t time;               /**< Time stamp, same format as XMC_ETH_MAC_GetRxTimeStamp() */
+  const void *tag;                       /**< Frame the time stamp belongs to: RX buffer the frame was handed
+                                              over in, TX frame buffer or zero-copy completion context */
+  XMC_ETH_MAC_TIMESTAMP_SOURCE_t source; /**< Received or transmitted frame */
+} XMC_ETH_MAC_TIMESTAMP_t;
+
+/**
+ * ETH MAC time stamp ring, filled by the driver as time stamped frames complete
+ */
+typedef struct XMC_ETH_MAC_TIMESTAMP_RING
+{
+  XMC_ETH_MAC_TIMESTAMP_t *entries; /**< Ring storage */
+  uint32_t overruns;                /**< Time stamps dropped because the ring was full */
+  uint8_t size;                     /**< Number of entries, one is kept free */
+  volatile uint8_t head;            /**< Next entry written by the driver */
+  volatile uint8_t tail;            /**< Next entry read by XMC_ETH_MAC_ReadTimeStamp() */
+} XMC_ETH_MAC_TIMESTAMP_RING_t;
+
+/**
+ * ETH MAC PTP servo configuration
+ */
+typedef struct XMC_ETH_MAC_PTP_SERVO_CONFIG
+{
+  int32_t kp;              /**< Proportional gain in Q16 ppb per nanosecond of offset */
+  int32_t ki;              /**< Integral gain in Q16 ppb per nanosecond of accumulated offset */
+  int32_t max_ppb;         /**< Frequency correction limit in ppb */
+  uint32_t step_threshold; /**< Offset in nanoseconds above which the clock is stepped, zero to never step */
+} XMC_ETH_MAC_PTP_SERVO_CONFIG_t;
+
+/**
+ * ETH MAC PTP servo statistics
+ */
+typedef struct XMC_ETH_MAC_PTP_STATISTICS
+{
+  uint32_t samples;    /**< Offset samples processed */
+  uint32_t steps;      /**< Clock steps */
+  int32_t offset;      /**< Last offset in nanoseconds */
+  int32_t offset_min;  /**< Smallest offset */
+  int32_t offset_max;  /**< Largest offset */
+  int32_t offset_mean; /**< Filtered offset (1/16 weight) */
+  uint32_t jitter;     /**< Filtered difference between consecutive offsets (1/16 weight) */
+} XMC_ETH_MAC_PTP_STATISTICS_t;
+
+/**
+ * ETH MAC PTP servo state
+ */
+typedef struct XMC_ETH_MAC_PTP_SERVO
+{
+  const XMC_ETH_MAC_PTP_SERVO_CONFIG_t *config; /**< Servo configuration */
+  int64_t integral;                   /**< Accumulated offset */
+  uint32_t addend;                    /**< Nominal addend register value */
+  int32_t freq_ppb;                   /**< Current frequency correction */
+  XMC_ETH_MAC_PTP_STATISTICS_t stats; /**< Offset and jitter statistics */
+} XMC_ETH_MAC_PTP_SERVO_t;
+
+/**
+ * ETH MAC non-blocking PHY access completion handler
+ */
+typedef void (*XMC_ETH_MAC_MDIO_HANDLER_t)(XMC_ETH_MAC_STATUS_t status, uint16_t data, void *context);
+
+/**
+ * ETH MAC link state change handler, called by the link state poller
+ */
+typedef void (*XMC_ETH_MAC_LINK_HANDLER_t)(XMC_ETH_LINK_STATUS_t status);
+
+/**
+ * ETH MAC queued PHY register access
+ */
+typedef struct XMC_ETH_MAC_MDIO_REQUEST
+{
+  XMC_ETH_MAC_MDIO_HANDLER_t handler; /**< Completion handler, optional for writes */
+  void *context;                      /**< User context passed to the handler */
+  uint16_t data;                      /**< Data to write */
+  uint8_t phy_addr;                   /**< PHY address */
+  uint8_t reg_addr;                   /**< Register address */
+  bool write;                         /**< Write or read access? */
+} XMC_ETH_MAC_MDIO_REQUEST_t;
+
+/**
+ * ETH MAC non-blocking MDIO engine state
+ */
+typedef struct XMC_ETH_MAC_MDIO
+{
+  XMC_ETH_MAC_MDIO_REQUEST_t *requests;    /**< Request queue storage */
+  XMC_ETH_MAC_LINK_HANDLER_t link_handler; /**< Link state change handler */
+  uint32_t timeout;                        /**< Access time-out in XMC_ETH_MAC_ProcessMdio() calls, zero for none */
+  uint32_t elapsed;                        /**< Calls since the active access was started */
+  uint32_t link_interval;                  /**< Link poll interval in XMC_ETH_MAC_ProcessMdio() calls, zero if stopped */
+  uint32_t link_countdown;                 /**< Calls left until the next link poll */
+  XMC_ETH_LINK_STATUS_t link_status;       /**< Last polled link state */
+  uint8_t size;                            /**< Number of queue entries, one is kept free */
+  uint8_t head;                            /**< Next entry to fill */
+  uint8_t tail;                            /**< Oldest entry, active if \a active is set */
+  uint8_t link_phy_addr;                   /**< PHY polled for link state */
+  bool active;                             /**< Access of the oldest entry in progress */
+  bool blocking;                           /**< Interface held by XMC_ETH_MAC_ReadPhy() or XMC_ETH_MAC_WritePhy() */
+  bool latched;                            /**< Active access ended, its result latched by a blocking access */
+  uint16_t latched_data;                   /**< Read data of the active access if \a latched is set */
+  bool link_poll_pending;                  /**< Link poll queued and not completed */
+} XMC_ETH_MAC_MDIO_t;
+
+/**
+ * ETH MAC multicast group managed by the multicast filter
+ */
+typedef struct XMC_ETH_MAC_MULTICAST_GROUP
+{
+  uint64_t addr;   /**< Group address, same layout as XMC_ETH_MAC_SetAddress() */
+  uint32_t frames; /**< Received frame count, weight for perfect filter slot selection */
+  uint16_t users;  /**< Number of joins not yet left */
+  uint8_t hash;    /**< Hash table bit index */
+  uint8_t slot;    /**< Perfect filter slot, zero if filtered through the hash table */
+} XMC_ETH_MAC_MULTICAST_GROUP_t;
+
+/**
+ * ETH MAC multicast filter state
+ */
+typedef struct XMC_ETH_MAC_MULTICAST_FILTER
+{
+  XMC_ETH_MAC_MULTICAST_GROUP_t *groups; /**< Group table storage */
+  uint64_t hash;                         /**< Hash table image */
+  uint16_t bins[64];                     /**< Hashed groups per hash table bit */
+  uint16_t size;                         /**< Number of entries in the group table */
+  uint16_t count;                        /**< Number of joined groups */
+  uint8_t first_slot;                    /**< First perfect filter slot owned by the filter */
+} XMC_ETH_MAC_MULTICAST_FILTER_t;
+
+/**
+ * ETH MAC statistics counters, extended to 64 bit
+ */
+typedef struct XMC_ETH_MAC_COUNTERS
+{
+  uint64_t mmc[XMC_ETH_MAC_MMC_COUNTER_NUM]; /**< MAC management counters, indexed by ::XMC_ETH_MAC_MMC_COUNTER_t */
+  uint64_t rx_missed_frames;                 /**< Frames dropped by the DMA for lack of a free receive descriptor */
+  uint64_t rx_overflow_frames;               /**< Frames dropped by the DMA on receive FIFO overflow */
+  uint64_t tx_busy;                          /**< Frames rejected by the driver with XMC_ETH_MAC_STATUS_BUSY */
+} XMC_ETH_MAC_COUNTERS_t;
+
+/**
+ * ETH MAC statistics state
+ */
+typedef struct XMC_ETH_MAC_STATISTICS
+{
+  XMC_ETH_MAC_COUNTERS_t total;                   /**< Counts since XMC_ETH_MAC_InitStatistics() */
+  XMC_ETH_MAC_COUNTERS_t interval;                /**< Counts between the last two XMC_ETH_MAC_UpdateStatistics() calls */
+  uint32_t mmc_last[XMC_ETH_MAC_MMC_COUNTER_NUM]; /**< Hardware counter values at the last update */
+  uint32_t tx_busy;                               /**< Running count of rejected frames, incremented by the driver */
+  uint32_t tx_busy_last;                          /**< \a tx_busy at the last update */
+} XMC_ETH_MAC_STATISTICS_t;
+
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+/**
+ * ETH MAC receive cycle counters, collected if XMC_ETH_MAC_INSTRUMENTATION_ENABLE is defined
+ */
+typedef struct XMC_ETH_MAC_RX_CYCLES
+{
+  uint64_t cycles;     /**< CPU cycles spent in calls that returned frames */
+  uint32_t frames;     /**< Frames returned by these calls */
+  uint32_t calls;      /**< Calls that returned at least one frame */
+  uint32_t max_cycles; /**< Longest call in CPU cycles */
+} XMC_ETH_MAC_RX_CYCLES_t;
+#endif
+
 /**
  * ETH driver structure
  */
@@ -286,6 +613,26 @@ typedef struct XMC_ETH_MAC
   uint8_t tx_index;                /**< Transmit descriptor index */
   uint8_t rx_index;                /**< Receive descriptor index */
   uint8_t tx_ts_index;             /**< Transmit time-stamp descriptor index */
+  uint8_t **rx_pool;               /**< Free RX buffers used to refill lent descriptors */
+  uint8_t rx_pool_size;            /**< How many entries in the RX buffer pool? */
+  uint8_t rx_pool_count;           /**< How many free RX buffers in the pool? */
+  uint8_t tx_done_index;           /**< Oldest transmit descriptor not yet reclaimed */
+  uint8_t tx_done_pending;         /**< Transmit descriptors handed to the DMA and not yet reclaimed */
+  XMC_ETH_MAC_TX_DONE_HANDLER_t tx_done_handler; /**< Zero-copy transmit completion handler */
+  const XMC_ETH_MAC_COALESCE_CONFIG_t *coalesce_config; /**< Adaptive interrupt coalescing configuration */
+  uint8_t rx_watchdog;             /**< Receive interrupt watchdog, zero if every frame raises an interrupt */
+  uint8_t tx_coalesce_frames;      /**< Transmitted frames per transmit interrupt, zero or one for every frame */
+  uint8_t tx_coalesce_count;       /**< Transmitted frames since the last transmit interrupt */
+  XMC_ETH_MAC_TIMESTAMP_RING_t *ts_ring; /**< Per-frame time stamp ring, NULL if not used */
+  XMC_ETH_MAC_MDIO_t *mdio;        /**< Non-blocking MDIO engine, NULL if not used */
+  XMC_ETH_MAC_MULTICAST_FILTER_t *mc_filter; /**< Multicast filter manager, NULL if not used */
+  XMC_ETH_MAC_STATISTICS_t *stats; /**< Statistics, NULL if not used */
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+  XMC_ETH_MAC_RX_CYCLES_t rx_cycles_single;       /**< Cycles of XMC_ETH_MAC_ReadFrame() */
+  XMC_ETH_MAC_RX_CYCLES_t rx_cycles_batch;        /**< Cycles of XMC_ETH_MAC_ReadFrames() */
+  XMC_ETH_MAC_RX_CYCLES_t rx_cycles_borrow;       /**< Cycles of XMC_ETH_MAC_BorrowRxFrame() */
+  XMC_ETH_MAC_RX_CYCLES_t rx_cycles_borrow_batch; /**< Cycles of XMC_ETH_MAC_BorrowRxFrames() */
+#endif
 } XMC_ETH_MAC_t;
 
 /* Anonymous structure/union guard end */
@@ -326,6 +673,7 @@ XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_Init(XMC_ETH_MAC_t *const eth_mac);
  * \par
  * The function initializes the RX descriptors in a chained configuration. It sets
  * up the status bit, control bit, buffer length and the buffer pointer.
+ * The buffer pointers are reset to the static RX buffers, so no RX frame may be lent.
  */
 void XMC_ETH_MAC_InitRxDescriptors(XMC_ETH_MAC_t *const eth_mac);
 
@@ -410,6 +758,10 @@ __STATIC_INLINE void XMC_ETH_MAC_Reset(XMC_ETH_MAC_t *const eth_mac)
  * \par
  * The function reads a PHY register. It essentially polls busy bit during max
  * PHY_TIMEOUT time and reads the information into 'data' when not busy.
+ * Use XMC_ETH_MAC_ReadPhyAsync() to avoid blocking. If XMC_ETH_MAC_InitMdio() was called,
+ * the function first waits, during the same time, for an access of the non-blocking engine
+ * to end. It then holds the interface for its own access, and XMC_ETH_MAC_ProcessMdio()
+ * starts no queued request meanwhile.
  */
 XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_ReadPhy(XMC_ETH_MAC_t *const eth_mac, uint8_t phy_addr, uint8_t reg_addr, uint16_t *data);
 
@@ -425,10 +777,120 @@ XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_ReadPhy(XMC_ETH_MAC_t *const eth_mac, uint8_t p
  *
  * \par
  * The function reads a PHY register. It essentially writes the data and polls
- * the busy bit until it is no longer busy.
+ * the busy bit until it is no longer busy. It shares the interface with the
+ * non-blocking engine like XMC_ETH_MAC_ReadPhy().
  */
 XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_WritePhy(XMC_ETH_MAC_t *const eth_mac, uint8_t phy_addr, uint8_t reg_addr, uint16_t data);
 
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param mdio MDIO engine state
+ * @param requests Request queue storage
+ * @param size Number of entries in \a requests, at least two
+ * @param timeout Access time-out in XMC_ETH_MAC_ProcessMdio() calls, zero to wait forever
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Initialize the non-blocking MDIO engine <br>
+ *
+ * \par
+ * PHY register accesses take several microseconds on the management interface.
+ * The engine queues them and lets XMC_ETH_MAC_ProcessMdio() start and complete them
+ * one at a time, so that the caller never spins on the busy bit. One queue entry is
+ * always kept free, so \a size - 1 requests can be pending.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_ReadPhyAsync(), XMC_ETH_MAC_WritePhyAsync(), XMC_ETH_MAC_ProcessMdio()\n\n\n
+ */
+void XMC_ETH_MAC_InitMdio(XMC_ETH_MAC_t *const eth_mac,
+                          XMC_ETH_MAC_MDIO_t *const mdio,
+                          XMC_ETH_MAC_MDIO_REQUEST_t *const requests,
+                          uint8_t size,
+                          uint32_t timeout);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param phy_addr PHY address
+ * @param reg_addr Register address
+ * @param handler Called from XMC_ETH_MAC_ProcessMdio() with the register value
+ * @param context User context passed to \a handler
+ * @return XMC_ETH_MAC_STATUS_t ETH MAC status, XMC_ETH_MAC_STATUS_BUSY if the queue is full
+ *
+ * \par<b>Description: </b><br>
+ * Queue a PHY register read <br>
+ *
+ * \par
+ * The handler receives XMC_ETH_MAC_STATUS_ERROR if the access timed out.
+ */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_ReadPhyAsync(XMC_ETH_MAC_t *const eth_mac,
+                                              uint8_t phy_addr,
+                                              uint8_t reg_addr,
+                                              XMC_ETH_MAC_MDIO_HANDLER_t handler,
+                                              void *const context);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param phy_addr PHY address
+ * @param reg_addr Register address
+ * @param data The data to write
+ * @param handler Called from XMC_ETH_MAC_ProcessMdio() on completion, may be NULL
+ * @param context User context passed to \a handler
+ * @return XMC_ETH_MAC_STATUS_t ETH MAC status, XMC_ETH_MAC_STATUS_BUSY if the queue is full
+ *
+ * \par<b>Description: </b><br>
+ * Queue a PHY register write <br>
+ */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_WritePhyAsync(XMC_ETH_MAC_t *const eth_mac,
+                                               uint8_t phy_addr,
+                                               uint8_t reg_addr,
+                                               uint16_t data,
+                                               XMC_ETH_MAC_MDIO_HANDLER_t handler,
+                                               void *const context);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Run the non-blocking MDIO engine <br>
+ *
+ * \par
+ * Call periodically, e.g. from a timer tick. Each call completes the active access
+ * if the busy bit has cleared, fails it after the configured time-out, and starts
+ * the next queued access. Handlers run in the caller's context and may queue
+ * further accesses.
+ */
+void XMC_ETH_MAC_ProcessMdio(XMC_ETH_MAC_t *const eth_mac);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param phy_addr PHY address
+ * @param interval Poll interval in XMC_ETH_MAC_ProcessMdio() calls
+ * @param handler Called on every link state change
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Start polling the PHY link state <br>
+ *
+ * \par
+ * The basic mode status register is read through the MDIO queue every \a interval
+ * calls of XMC_ETH_MAC_ProcessMdio(). The first poll is queued on the next call,
+ * and the handler is first called once the link comes up.
+ */
+void XMC_ETH_MAC_StartLinkPolling(XMC_ETH_MAC_t *const eth_mac,
+                                  uint8_t phy_addr,
+                                  uint32_t interval,
+                                  XMC_ETH_MAC_LINK_HANDLER_t handler);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Stop polling the PHY link state <br>
+ */
+void XMC_ETH_MAC_StopLinkPolling(XMC_ETH_MAC_t *const eth_mac);
+
 /**
  * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
  * @param port_ctrl Port control configuration
@@ -511,7 +973,9 @@ __STATIC_INLINE uint64_t XMC_ETH_MAC_GetAddress(XMC_ETH_MAC_t *const eth_mac)
  * Set perfect filter for address filtering <br>
  *
  * \par
- * The function can be used to set perfect filter for address filtering.
+ * The function can be used to set perfect filter for address filtering. The
+ * index selects one of the MAC_ADDRESS1 to MAC_ADDRESS3 register pairs, which is
+ * enabled for comparison.
  */
 void XMC_ETH_MAC_SetAddressPerfectFilter(XMC_ETH_MAC_t *const eth_mac, uint8_t index, const uint64_t addr, uint32_t flags);
 
@@ -766,6 +1230,148 @@ __STATIC_INLINE void XMC_ETH_MAC_DisableUnicastHashFilter(XMC_ETH_MAC_t *const e
   eth_mac->regs->MAC_FRAME_FILTER &= (uint32_t)~ETH_MAC_FRAME_FILTER_HUC_Msk;
 }
 
+/**
+ * @param addr Address value, same layout as XMC_ETH_MAC_SetAddress()
+ * @return uint32_t Hash table bit index (0-63)
+ *
+ * \par<b>Description: </b><br>
+ * Compute the hash table bit of an address <br>
+ *
+ * \par
+ * The MAC indexes the hash table with the upper six bits of the bit reversed
+ * CRC-32 of the destination address. Bits 0-31 are in HASH_TABLE_LOW, bits
+ * 32-63 in HASH_TABLE_HIGH.
+ */
+uint32_t XMC_ETH_MAC_GetAddressHash(const uint64_t addr);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param filter Multicast filter state
+ * @param groups Group table storage
+ * @param size Number of entries in \a groups
+ * @param first_slot First perfect filter slot (1-3) given to the filter, 4 to use the hash table only
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Initialize the multicast filter manager <br>
+ *
+ * \par
+ * The manager keeps the perfect filter slots from \a first_slot to 3 and the hash
+ * table in sync with the joined multicast groups. Hash table bits are reference
+ * counted, so joining or leaving a group touches one hash register and never
+ * recomputes the table. The hash table is cleared, the owned slots are disabled
+ * and multicast hash filtering is enabled together with perfect filtering.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_JoinMulticastGroup(), XMC_ETH_MAC_LeaveMulticastGroup(), XMC_ETH_MAC_RebalanceMulticastFilter()\n\n\n
+ */
+void XMC_ETH_MAC_InitMulticastFilter(XMC_ETH_MAC_t *const eth_mac,
+                                     XMC_ETH_MAC_MULTICAST_FILTER_t *const filter,
+                                     XMC_ETH_MAC_MULTICAST_GROUP_t *const groups,
+                                     uint16_t size,
+                                     uint8_t first_slot);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param addr Group address
+ * @return XMC_ETH_MAC_STATUS_t ETH MAC status, XMC_ETH_MAC_STATUS_ERROR if the group table is full
+ *
+ * \par<b>Description: </b><br>
+ * Join a multicast group <br>
+ *
+ * \par
+ * Joining an already joined group only counts the additional user. A new group
+ * takes a free perfect filter slot if there is one, otherwise its hash table bit.
+ */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_JoinMulticastGroup(XMC_ETH_MAC_t *const eth_mac, const uint64_t addr);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param addr Group address
+ * @return XMC_ETH_MAC_STATUS_t ETH MAC status, XMC_ETH_MAC_STATUS_ERROR if the group is not joined
+ *
+ * \par<b>Description: </b><br>
+ * Leave a multicast group <br>
+ *
+ * \par
+ * The group is removed once all its users have left. Its hash table bit is
+ * cleared when no other group shares it, and a freed perfect filter slot is
+ * given to the busiest group still in the hash table.
+ */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_LeaveMulticastGroup(XMC_ETH_MAC_t *const eth_mac, const uint64_t addr);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param addr Group address
+ * @return XMC_ETH_MAC_MULTICAST_GROUP_t* Group entry, NULL if the group is not joined
+ *
+ * \par<b>Description: </b><br>
+ * Find a joined multicast group <br>
+ *
+ * \par
+ * The application increments the \a frames member of the returned entry for
+ * frames received on the group, to steer XMC_ETH_MAC_RebalanceMulticastFilter().
+ * The entry is only valid until the next join or leave.
+ */
+XMC_ETH_MAC_MULTICAST_GROUP_t *XMC_ETH_MAC_FindMulticastGroup(XMC_ETH_MAC_t *const eth_mac, const uint64_t addr);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Give the perfect filter slots to the busiest multicast groups <br>
+ *
+ * \par
+ * The groups with the highest frame counts get the perfect filter slots, the
+ * others go through the hash table. Demoted groups are added to the hash table
+ * before their slots are reprogrammed, so no frames are dropped during the move.
+ * The frame counts are halved afterwards, so that the selection follows the recent
+ * traffic. Call periodically from thread context.
+ */
+void XMC_ETH_MAC_RebalanceMulticastFilter(XMC_ETH_MAC_t *const eth_mac);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param stats Statistics state
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Initialize the statistics <br>
+ *
+ * \par
+ * The MAC management counters are configured to roll over and not to reset on
+ * read, and their interrupts are masked since the counters are polled. The current
+ * hardware counts become the baseline, so totals start from zero. From now on the
+ * driver counts the frames it rejects with XMC_ETH_MAC_STATUS_BUSY in \a stats.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_UpdateStatistics()\n\n\n
+ */
+void XMC_ETH_MAC_InitStatistics(XMC_ETH_MAC_t *const eth_mac, XMC_ETH_MAC_STATISTICS_t *const stats);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Snapshot the statistics counters <br>
+ *
+ * \par
+ * The function reads all MAC management counters and the DMA missed frame and
+ * overflow counters. The counts since the previous call are stored in the
+ * \a interval member and added to the \a total member of the statistics state.
+ * Dividing the interval counts by the call period gives the rates.
+ *
+ * \par<b>Note:</b><br>
+ * The 32-bit hardware counters may wrap at most once between two calls. At 100 Mbit/s
+ * the octet counters wrap after about 340 seconds. The DMA missed frame counters are
+ * only 16 bits (11 bits for FIFO overflows) and clear on read. Once their overflow flag
+ * is set the count is reported as the counter maximum, a lower bound, so call often
+ * enough under overload.
+ */
+void XMC_ETH_MAC_UpdateStatistics(XMC_ETH_MAC_t *const eth_mac);
+
 /**
  * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
  * @param frame A pointer to a uint8_t constant, holding the frame to be transmitted
@@ -786,6 +1392,67 @@ XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_SendFrame(XMC_ETH_MAC_t *const eth_mac,
                                            uint32_t len,
                                            uint32_t flags);
 
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param fragments List of frame fragments (headers, payload, ...) in transmission order
+ * @param num Number of fragments, each one takes a transmit descriptor
+ * @param flags Additional flags: ored combination of ::XMC_ETH_MAC_TX_FRAME_t or zero.
+ *              XMC_ETH_MAC_TX_FRAME_FRAGMENT is not supported.
+ * @param context User context passed to the transmit completion handler
+ * @return XMC_ETH_MAC_STATUS_t ETH MAC status (XMC_ETH_MAC_STATUS_BUSY if not enough descriptors
+ *         are free, XMC_ETH_MAC_STATUS_ERROR if \a num is zero or exceeds the number of transmit
+ *         descriptors, or a fragment is empty or longer than 8191 bytes, XMC_ETH_MAC_STATUS_OK otherwise).
+ *
+ * \par<b>Description: </b><br>
+ * Send a frame from scattered buffers without copying <br>
+ *
+ * \par
+ * The function points the buffer of one chained transmit descriptor at each fragment
+ * and hands the descriptors to the DMA in a single step. The fragments are read by
+ * the DMA directly from the caller memory, which must not be modified until the frame
+ * is reported complete by XMC_ETH_MAC_ProcessTxDone().
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_SetTxDoneHandler(), XMC_ETH_MAC_ProcessTxDone()
+ */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_SendFrameScatter(XMC_ETH_MAC_t *const eth_mac,
+                                                  const XMC_ETH_MAC_TX_FRAGMENT_t *const fragments,
+                                                  uint32_t num,
+                                                  uint32_t flags,
+                                                  void *const context);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param handler Function called once for every completed zero-copy frame
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Set the zero-copy transmit completion handler <br>
+ *
+ * \par
+ * The handler is invoked from XMC_ETH_MAC_ProcessTxDone() with the context given to
+ * XMC_ETH_MAC_SendFrameScatter(), at which point the fragment memory may be reused.
+ */
+__STATIC_INLINE void XMC_ETH_MAC_SetTxDoneHandler(XMC_ETH_MAC_t *const eth_mac, XMC_ETH_MAC_TX_DONE_HANDLER_t handler)
+{
+  eth_mac->tx_done_handler = handler;
+}
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @return uint32_t Number of zero-copy frames completed
+ *
+ * \par<b>Description: </b><br>
+ * Reclaim transmit descriptors of completed zero-copy frames <br>
+ *
+ * \par
+ * The function walks the descriptors released by the DMA, calls the completion handler
+ * for each zero-copy frame and restores the driver buffers, so the descriptors can be
+ * used again by XMC_ETH_MAC_SendFrame() and XMC_ETH_MAC_SendFrameScatter(). It is
+ * typically called from the transmit event (XMC_ETH_MAC_EVENT_TRANSMIT) handler.
+ */
+uint32_t XMC_ETH_MAC_ProcessTxDone(XMC_ETH_MAC_t *const eth_mac);
+
 /**
  * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
  * @param frame A constant pointer to a uint8_t constant, holding the received frame
@@ -813,6 +1480,205 @@ uint32_t XMC_ETH_MAC_ReadFrame(XMC_ETH_MAC_t *const eth_mac, uint8_t *const fram
  */
 uint32_t XMC_ETH_MAC_GetRxFrameSize(XMC_ETH_MAC_t *const eth_mac);
 
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @return uint32_t Checksum offload status: ored combination of ::XMC_ETH_MAC_RX_CHECKSUM_t,
+ *         zero if the frame was not checked
+ *
+ * \par<b>Description: </b><br>
+ * Get RX checksum offload status <br>
+ *
+ * \par
+ * The function returns the checksum verification result of the current RX frame, taken
+ * from the extended status of the enhanced descriptor. It has to be called before the
+ * frame is read, or from the XMC_ETH_MAC_ReadFrames() handler. Evaluate the result with
+ * XMC_ETH_MAC_IsRxIPHeaderChecksumValid() and XMC_ETH_MAC_IsRxPayloadChecksumValid().
+ */
+uint32_t XMC_ETH_MAC_GetRxChecksumStatus(const XMC_ETH_MAC_t *const eth_mac);
+
+/**
+ * @param status Checksum offload status returned by XMC_ETH_MAC_GetRxChecksumStatus()
+ * @return bool true if the IPv4 header checksum was verified by hardware
+ *
+ * \par<b>Description: </b><br>
+ * Check the hardware verified IPv4 header checksum <br>
+ */
+__STATIC_INLINE bool XMC_ETH_MAC_IsRxIPHeaderChecksumValid(uint32_t status)
+{
+  return ((status & ((uint32_t)XMC_ETH_MAC_RX_CHECKSUM_IPV4 |
+                     (uint32_t)XMC_ETH_MAC_RX_CHECKSUM_IP_HEADER_ERROR |
+                     (uint32_t)XMC_ETH_MAC_RX_CHECKSUM_BYPASSED)) == (uint32_t)XMC_ETH_MAC_RX_CHECKSUM_IPV4);
+}
+
+/**
+ * @param status Checksum offload status returned by XMC_ETH_MAC_GetRxChecksumStatus()
+ * @return bool true if the TCP/UDP/ICMP checksum was verified by hardware
+ *
+ * \par<b>Description: </b><br>
+ * Check the hardware verified TCP/UDP/ICMP checksum <br>
+ */
+__STATIC_INLINE bool XMC_ETH_MAC_IsRxPayloadChecksumValid(uint32_t status)
+{
+  return (((status & ((uint32_t)XMC_ETH_MAC_RX_CHECKSUM_IPV4 | (uint32_t)XMC_ETH_MAC_RX_CHECKSUM_IPV6)) != 0U) &&
+          ((status & (uint32_t)XMC_ETH_MAC_RX_CHECKSUM_PAYLOAD_TYPE) != 0U) &&
+          ((status & ((uint32_t)XMC_ETH_MAC_RX_CHECKSUM_IP_HEADER_ERROR |
+                      (uint32_t)XMC_ETH_MAC_RX_CHECKSUM_PAYLOAD_ERROR |
+                      (uint32_t)XMC_ETH_MAC_RX_CHECKSUM_BYPASSED)) == 0U));
+}
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param pool Storage for the free buffer list, at least \a num entries
+ * @param buffers Spare RX buffers, \a num blocks of ::XMC_ETH_MAC_BUF_SIZE bytes
+ * @param num Number of spare RX buffers
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Initialize the RX buffer pool used for zero-copy reception <br>
+ *
+ * \par
+ * The function fills the free buffer list with the spare buffers. Every frame lent by
+ * XMC_ETH_MAC_BorrowRxFrame() takes one buffer from the pool to refill its descriptor,
+ * so \a num bounds the number of frames the application can hold at the same time.
+ * Call it after XMC_ETH_MAC_Init() and before the receiver is enabled.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_BorrowRxFrame(), XMC_ETH_MAC_ReturnRxFrame()
+ */
+void XMC_ETH_MAC_InitRxBufferPool(XMC_ETH_MAC_t *const eth_mac, uint8_t **const pool, uint8_t *const buffers, uint8_t num);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param frame Received frame: buffer and length
+ * @return XMC_ETH_MAC_STATUS_t ETH MAC status (XMC_ETH_MAC_STATUS_BUSY if no frame is pending or
+ *         the pool is empty, XMC_ETH_MAC_STATUS_ERROR if the frame was dropped, XMC_ETH_MAC_STATUS_OK otherwise)
+ *
+ * \par<b>Description: </b><br>
+ * Borrow the next received frame without copying it <br>
+ *
+ * \par
+ * The function hands the DMA buffer of the current RX descriptor to the application and
+ * refills the descriptor with a buffer from the pool, so the descriptor goes back to the
+ * DMA immediately. The application owns \a frame->buffer until it gives it back with
+ * XMC_ETH_MAC_ReturnRxFrame(); lent frames may be returned in any order. Frames received
+ * with errors are returned to the DMA and reported as XMC_ETH_MAC_STATUS_ERROR. When the
+ * pool is empty the frame is left in the descriptor and can still be read with
+ * XMC_ETH_MAC_ReadFrame().
+ *
+ * \par<b>Note:</b><br>
+ * The pool is not protected against concurrent access. Borrowing and returning from
+ * different interrupt levels requires a critical section around the calls.
+ * XMC_ETH_MAC_FlushRx() keeps the buffers of the descriptors and the pool, so frames may stay
+ * lent across a flush. XMC_ETH_MAC_InitRxDescriptors() assigns the static buffers again and
+ * must only be called with all frames returned.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_InitRxBufferPool(), XMC_ETH_MAC_ReturnRxFrame()
+ */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_BorrowRxFrame(XMC_ETH_MAC_t *const eth_mac, XMC_ETH_MAC_RX_FRAME_t *const frame);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param frame Frame previously obtained by XMC_ETH_MAC_BorrowRxFrame()
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Return a lent frame buffer to the RX buffer pool <br>
+ *
+ * \par
+ * The function puts the frame buffer back on the free list, where it is used to refill
+ * a descriptor by a later XMC_ETH_MAC_BorrowRxFrame() call. If the free list is already
+ * full, i.e. a frame was returned twice, the call is ignored.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_BorrowRxFrame()
+ */
+void XMC_ETH_MAC_ReturnRxFrame(XMC_ETH_MAC_t *const eth_mac, const XMC_ETH_MAC_RX_FRAME_t *const frame);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param frames Array receiving the lent frames
+ * @param max_frames Size of the \a frames array
+ * @return uint32_t Number of frames lent to the application
+ *
+ * \par<b>Description: </b><br>
+ * Borrow all received frames in one pass <br>
+ *
+ * \par
+ * The function works like XMC_ETH_MAC_BorrowRxFrame() on every descriptor completed by
+ * the DMA, stopping when the ring, the pool or the array is exhausted. Erroneous frames
+ * are dropped. The receive DMA is resumed at most once for the whole burst.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_BorrowRxFrame(), XMC_ETH_MAC_ReturnRxFrame()
+ */
+uint32_t XMC_ETH_MAC_BorrowRxFrames(XMC_ETH_MAC_t *const eth_mac, XMC_ETH_MAC_RX_FRAME_t *const frames, uint32_t max_frames);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param handler Function called for every valid frame
+ * @param context User context passed to \a handler
+ * @param max_frames Maximum number of frames to process
+ * @return uint32_t Number of frames passed to \a handler
+ *
+ * \par<b>Description: </b><br>
+ * Read all received frames in one pass <br>
+ *
+ * \par
+ * The function walks every descriptor completed by the DMA and passes each valid frame
+ * to \a handler directly from the DMA buffer. The buffer is returned to the DMA when the
+ * handler returns, so the handler must consume or copy the data. Erroneous frames are
+ * dropped. The receive DMA is resumed at most once for the whole burst, instead of once
+ * per frame as with XMC_ETH_MAC_ReadFrame().
+ */
+uint32_t XMC_ETH_MAC_ReadFrames(XMC_ETH_MAC_t *const eth_mac,
+                                XMC_ETH_MAC_RX_FRAME_HANDLER_t handler,
+                                void *const context,
+                                uint32_t max_frames);
+
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Start the receive cycle counters <br>
+ *
+ * \par
+ * The instrumentation is compiled in if XMC_ETH_MAC_INSTRUMENTATION_ENABLE is defined.
+ * The function starts the DWT cycle counter and clears the receive cycle counters. Every
+ * call of XMC_ETH_MAC_ReadFrame() is then accounted in \a rx_cycles_single, of
+ * XMC_ETH_MAC_ReadFrames() in \a rx_cycles_batch, of XMC_ETH_MAC_BorrowRxFrame() in
+ * \a rx_cycles_borrow and of XMC_ETH_MAC_BorrowRxFrames() in \a rx_cycles_borrow_batch,
+ * including the descriptor return and the DMA resume. The copying and the zero-copy
+ * paths can so be compared. Calls that return no frame are not counted, so polling does not
+ * dilute the figures. The time spent in the XMC_ETH_MAC_ReadFrames() handler is included.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_GetRxCyclesPerFrame()
+ */
+void XMC_ETH_MAC_InitRxCycleCounters(XMC_ETH_MAC_t *const eth_mac);
+
+/**
+ * @param counters Receive cycle counters of the XMC_ETH_MAC_t structure, e.g. \a rx_cycles_single
+ * @return uint32_t Average CPU cycles per received frame, zero if no frame was counted
+ *
+ * \par<b>Description: </b><br>
+ * Get the receive cost per frame <br>
+ *
+ * \par
+ * Comparing the single frame and batch figures under a small frame flood shows the
+ * saving of the batch receive functions.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_InitRxCycleCounters()
+ */
+__STATIC_INLINE uint32_t XMC_ETH_MAC_GetRxCyclesPerFrame(const XMC_ETH_MAC_RX_CYCLES_t *const counters)
+{
+  return (counters->frames == 0U) ? 0U : (uint32_t)(counters->cycles / counters->frames);
+}
+#endif
+
 /**
  * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
  * @return None
@@ -1245,6 +2111,8 @@ void XMC_ETH_MAC_FlushTx(XMC_ETH_MAC_t *const eth_mac);
  *
  * \par
  * The function initializes the RX DMA descriptors and enables the DMA transmission.
+ * Each descriptor keeps its current buffer, so frames lent with XMC_ETH_MAC_BorrowRxFrame()
+ * and the buffers in the pool stay valid.
  */
 void XMC_ETH_MAC_FlushRx(XMC_ETH_MAC_t *const eth_mac);
 
@@ -1516,6 +2384,96 @@ XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_GetRxTimeStamp(XMC_ETH_MAC_t *const eth_mac, XM
  */
 XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_GetTxTimeStamp(XMC_ETH_MAC_t *const eth_mac, XMC_ETH_MAC_TIME_t *const time);
 
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param ring Time stamp ring state
+ * @param entries Ring storage
+ * @param size Number of entries in \a entries
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Initialize the per-frame time stamp ring <br>
+ *
+ * \par
+ * Once the ring is set, the driver queues the time stamp of every frame it completes:
+ * received frames when they are read, borrowed or passed to the XMC_ETH_MAC_ReadFrames()
+ * handler, transmitted frames when XMC_ETH_MAC_ProcessTxDone() reclaims them. Each entry
+ * carries the frame it belongs to, so no time stamp polling is needed.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_ReadTimeStamp()
+ */
+void XMC_ETH_MAC_InitTimeStampRing(XMC_ETH_MAC_t *const eth_mac,
+                                   XMC_ETH_MAC_TIMESTAMP_RING_t *const ring,
+                                   XMC_ETH_MAC_TIMESTAMP_t *const entries,
+                                   uint8_t size);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param timestamp Destination of the oldest queued time stamp
+ * @return XMC_ETH_MAC_STATUS_t ETH MAC status (XMC_ETH_MAC_STATUS_BUSY if the ring is empty,
+ *         XMC_ETH_MAC_STATUS_OK otherwise)
+ *
+ * \par<b>Description: </b><br>
+ * Read a time stamp from the ring <br>
+ *
+ * \par
+ * The ring has a single producer (the driver) and a single consumer, so it can be read
+ * from thread level while frames complete in interrupt context.
+ */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_ReadTimeStamp(XMC_ETH_MAC_t *const eth_mac, XMC_ETH_MAC_TIMESTAMP_t *const timestamp);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param servo Servo state
+ * @param config Servo configuration, must stay valid while the servo is used
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Initialize the PTP clock servo <br>
+ *
+ * \par
+ * The servo steers the PTP clock frequency through the addend register, so PTP must be
+ * initialized with XMC_ETH_MAC_TIMESTAMP_CONFIG_FINE_UPDATE first. The addend value at this
+ * point is taken as the nominal frequency.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_InitPTP(), XMC_ETH_MAC_UpdatePTPServo()
+ */
+void XMC_ETH_MAC_InitPTPServo(XMC_ETH_MAC_t *const eth_mac,
+                              XMC_ETH_MAC_PTP_SERVO_t *const servo,
+                              const XMC_ETH_MAC_PTP_SERVO_CONFIG_t *const config);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param servo Servo state
+ * @param offset Offset of the local clock from the master in nanoseconds, positive if the local clock is ahead
+ * @return XMC_ETH_MAC_STATUS_t ETH MAC status (XMC_ETH_MAC_STATUS_BUSY if the previous correction is
+ *         still pending in hardware, XMC_ETH_MAC_STATUS_OK otherwise)
+ *
+ * \par<b>Description: </b><br>
+ * Feed an offset sample to the PTP clock servo <br>
+ *
+ * \par
+ * The function runs one step of a PI controller and writes the resulting frequency
+ * correction to the addend register. Samples are expected at a fixed interval, e.g. once
+ * per PTP sync message. Offsets larger than the step threshold step the clock instead.
+ * Offset and jitter statistics are updated with every sample and can be read from
+ * \a servo->stats.
+ */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_UpdatePTPServo(XMC_ETH_MAC_t *const eth_mac,
+                                                XMC_ETH_MAC_PTP_SERVO_t *const servo,
+                                                int32_t offset);
+
+/**
+ * @param servo Servo state
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Reset the PTP servo statistics <br>
+ */
+void XMC_ETH_MAC_ResetPTPServoStatistics(XMC_ETH_MAC_PTP_SERVO_t *const servo);
+
 /**
  * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
  * @param event Which event (or a combination of logically OR'd events) needs to be enabled?
@@ -1542,6 +2500,87 @@ void XMC_ETH_MAC_EnableEvent(XMC_ETH_MAC_t *const eth_mac, uint32_t event);
  */
 void XMC_ETH_MAC_DisableEvent(XMC_ETH_MAC_t *const eth_mac, uint32_t event);
 
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param watchdog Receive interrupt delay in units of 256 system clock cycles, zero to disable
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Set the receive interrupt watchdog <br>
+ *
+ * \par
+ * With a non-zero \a watchdog the RX descriptors no longer raise the receive event on
+ * completion. Instead the event is raised when the watchdog expires after a frame was
+ * received, so a burst of frames is reported by a single interrupt. With a zero value
+ * every received frame raises the event again.
+ */
+void XMC_ETH_MAC_SetRxInterruptWatchdog(XMC_ETH_MAC_t *const eth_mac, uint8_t watchdog);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param frames Number of frames per transmit event, zero or one to raise the event for every frame
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Set transmit interrupt coalescing <br>
+ *
+ * \par
+ * Of the frames sent with XMC_ETH_MAC_TX_FRAME_EVENT, only every \a frames-th requests the
+ * transmit event. Frames without an event still complete and are reclaimed together with
+ * the next frame that raises it. The event is requested regardless of the count when the
+ * DMA has no earlier frame pending, so the ring drains with this frame, and when the frame
+ * fills the ring, so no further frame can be queued before a reclaim.
+ *
+ * \par
+ * A burst that ends while the DMA is still busy leaves its last frames without an event.
+ * With coalescing enabled, call XMC_ETH_MAC_ProcessTxDone() from a periodic timer as well,
+ * e.g. next to XMC_ETH_MAC_UpdateCoalescing(), to reclaim them.
+ */
+void XMC_ETH_MAC_SetTxInterruptCoalescing(XMC_ETH_MAC_t *const eth_mac, uint8_t frames);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param config Adaptive coalescing configuration, must stay valid while coalescing is used
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Initialize adaptive interrupt coalescing <br>
+ *
+ * \par
+ * The function stores the configuration and starts with per-frame interrupts. The
+ * coalescing delays are then adjusted by XMC_ETH_MAC_UpdateCoalescing().
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_UpdateCoalescing()
+ */
+void XMC_ETH_MAC_InitCoalescing(XMC_ETH_MAC_t *const eth_mac, const XMC_ETH_MAC_COALESCE_CONFIG_t *const config);
+
+/**
+ * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
+ * @param frames Number of frames handled since the previous call
+ * @return None
+ *
+ * \par<b>Description: </b><br>
+ * Update adaptive interrupt coalescing <br>
+ *
+ * \par
+ * The function is meant to be called at a fixed interval, e.g. from a periodic timer.
+ * Up to \a rate_low frames per interval every frame raises an interrupt, so a quiet link
+ * sees no added latency. Above it, the receive watchdog and the transmit frame count grow
+ * linearly with the rate and reach their maximum at \a rate_high frames per interval.
+ * The hardware is only reprogrammed when the settings change.
+ *
+ * \par
+ * Frames at the end of a transmit burst may not request the transmit event. The same timer
+ * should therefore call XMC_ETH_MAC_ProcessTxDone(), which reclaims by descriptor ownership
+ * and does not depend on the event.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_ETH_MAC_InitCoalescing(), XMC_ETH_MAC_SetRxInterruptWatchdog(), XMC_ETH_MAC_SetTxInterruptCoalescing(),
+ * XMC_ETH_MAC_ProcessTxDone()
+ */
+void XMC_ETH_MAC_UpdateCoalescing(XMC_ETH_MAC_t *const eth_mac, uint32_t frames);
+
 /**
  * @param eth_mac A constant pointer to XMC_ETH_MAC_t, pointing to the ETH MAC base address
  * @param event The status of which event (or a combination of logically OR'd events) needs to be cleared?
@@ -36,6 +36,9 @@
  * Change History
  * --------------
  *
+ * 2026-10-17:
+ *     - Added interrupt driven queue of master transactions on the USIC FIFOs <br>
+ *
  * 2015-02-20:
  *     - Initial <br>
  *      
@@ -96,6 +99,8 @@
 	  The master/slave operation of an IIC bus participant can change from frame to frame. <br>
  *	* Efficient frame handling (low software effort), also allowing DMA transfers <br>
  *	* Powerful interrupt handling due to multitude of indication flags <br>
+ *	* Interrupt driven queue of write, read and write-then-read master transactions on the FIFOs using XMC_I2C_CH_QUEUE_Init(),
+ *	  XMC_I2C_CH_QUEUE_Submit() and XMC_I2C_CH_QUEUE_IRQHandler() <br>
  * @{
  */
 
@@ -131,7 +136,10 @@ typedef enum XMC_I2C_CH_STATUS
 {
   XMC_I2C_CH_STATUS_OK,      /**< Status OK */
   XMC_I2C_CH_STATUS_ERROR,   /**< Status ERROR */
-  XMC_I2C_CH_STATUS_BUSY     /**< Status BUSY */
+  XMC_I2C_CH_STATUS_BUSY,    /**< Status BUSY */
+  XMC_I2C_CH_STATUS_NACK,    /**< Transaction not acknowledged by the slave */
+  XMC_I2C_CH_STATUS_ARBITRATION_LOST, /**< Transaction aborted, arbitration lost to another master */
+  XMC_I2C_CH_STATUS_TIMEOUT  /**< Transaction aborted, not completed in time */
 } XMC_I2C_CH_STATUS_t;
 
 /**
@@ -251,6 +259,66 @@ typedef struct XMC_I2C_CH_CONFIG
                             A 10-bit address needs to be ORed with XMC_I2C_10BIT_ADDR_GROUP. */
 } XMC_I2C_CH_CONFIG_t;
 
+/**
+ * I2C master transaction completion handler
+ */
+typedef void (*XMC_I2C_CH_HANDLER_t)(XMC_I2C_CH_STATUS_t status, void *context);
+
+/**
+ * I2C master transaction. Data is written first; if data is also to be read, it is read after a repeated start.
+ */
+typedef struct XMC_I2C_CH_TRANSACTION
+{
+  const uint8_t *tx_data;         /**< Data to write, may be NULL if \a tx_count is 0 */
+  uint8_t *rx_data;               /**< Buffer for the read data, may be NULL if \a rx_count is 0 */
+  XMC_I2C_CH_HANDLER_t handler;   /**< Completion handler, optional */
+  void *context;                  /**< User context passed to \a handler */
+  uint16_t tx_count;              /**< Number of bytes to write */
+  uint16_t rx_count;              /**< Number of bytes to read */
+  uint16_t address;               /**< 7-bit slave address, left shifted by 1 */
+  uint16_t timeout;               /**< Timeout in calls of XMC_I2C_CH_QUEUE_Tick(), 0 to wait forever */
+} XMC_I2C_CH_TRANSACTION_t;
+
+/**
+ * I2C master transaction queue configuration
+ */
+typedef struct XMC_I2C_CH_QUEUE_CONFIG
+{
+  XMC_I2C_CH_TRANSACTION_t *transactions; /**< Queue storage */
+  uint8_t size;                           /**< Number of queue entries, one is kept free */
+  XMC_USIC_CH_FIFO_SIZE_t tx_fifo_size;   /**< Transmit FIFO size. \b Range: @ref XMC_USIC_CH_FIFO_SIZE_2WORDS.. @ref XMC_USIC_CH_FIFO_SIZE_32WORDS */
+  XMC_USIC_CH_FIFO_SIZE_t rx_fifo_size;   /**< Receive FIFO size. \b Range: @ref XMC_USIC_CH_FIFO_SIZE_2WORDS.. @ref XMC_USIC_CH_FIFO_SIZE_32WORDS */
+  uint8_t tx_fifo_pointer;                /**< Start of the transmit FIFO in the USIC FIFO buffer. \b Range: 0 to 63 */
+  uint8_t rx_fifo_pointer;                /**< Start of the receive FIFO in the USIC FIFO buffer. \b Range: 0 to 63 */
+  uint8_t tx_fifo_limit;                  /**< Transmit FIFO refill level. \b Range: 0 to transmit FIFO size - 1 */
+  uint8_t rx_fifo_limit;                  /**< Receive FIFO drain level. \b Range: 0 to receive FIFO size - 1 */
+  uint8_t service_request;                /**< Service request line of the FIFO and protocol events. \b Range: 0 to 5 */
+} XMC_I2C_CH_QUEUE_CONFIG_t;
+
+/**
+ * I2C master transaction queue state
+ */
+typedef struct XMC_I2C_CH_QUEUE
+{
+  XMC_USIC_CH_t *channel;                 /**< USIC channel */
+  XMC_I2C_CH_TRANSACTION_t *transactions; /**< Queue storage */
+  uint32_t tx_fifo_size;                  /**< Transmit FIFO size in words */
+  uint32_t rx_fifo_size;                  /**< Receive FIFO size in words */
+  volatile uint32_t ticks;                /**< Calls of XMC_I2C_CH_QUEUE_Tick() */
+  uint32_t start_tick;                    /**< Value of \a ticks when the current transaction started */
+  XMC_I2C_CH_STATUS_t status;             /**< Result of the current transaction */
+  uint16_t timeout;                       /**< Timeout of the current transaction */
+  uint16_t tx_index;                      /**< Bytes of the current transaction written to the transmit FIFO */
+  uint16_t rx_index;                      /**< Bytes of the current transaction read from the receive FIFO */
+  uint16_t rx_requested;                  /**< Receive commands of the current transaction written to the transmit FIFO */
+  volatile uint8_t step;                  /**< Next command of the current transaction */
+  uint8_t service_request;                /**< Service request line of the FIFO and protocol events */
+  uint8_t size;                           /**< Number of queue entries */
+  uint8_t head;                           /**< Next entry to fill */
+  uint8_t tail;                           /**< Oldest entry, in transfer if \a active is set */
+  bool active;                            /**< Transaction in transfer */
+} XMC_I2C_CH_QUEUE_t;
+
 /*******************************************************************************
  * API PROTOTYPES
  *******************************************************************************/
@@ -711,6 +779,97 @@ __STATIC_INLINE void XMC_I2C_CH_DisableAcknowledgeAddress0(XMC_USIC_CH_t *const
   channel->PCR_IICMode &= ~USIC_CH_PCR_IICMode_ACK00_Msk;
 }
 
+/**
+ * @param queue I2C master transaction queue state
+ * @param channel Pointer to USIC channel handler of type @ref XMC_USIC_CH_t \n
+ * 				  \b Range: @ref XMC_I2C0_CH0, @ref XMC_I2C0_CH1,@ref XMC_I2C1_CH0,@ref XMC_I2C1_CH1,@ref XMC_I2C2_CH0,@ref XMC_I2C2_CH1 @note Availability of I2C1 and I2C2 depends on device selection
+ * @param config Queue storage, FIFO layout and service request line
+ * @return Status of the initialization.\n
+ * 			\b Range: @ref XMC_I2C_CH_STATUS_OK, or @ref XMC_I2C_CH_STATUS_ERROR if the configuration is invalid.
+ *
+ * \par<b>Description</b><br>
+ * Initializes an interrupt driven queue of master transactions.\n\n
+ * A transaction is a write, a read, or a write followed by a read after a repeated start, closed by a stop condition.
+ * The commands of a transaction are written to the transmit FIFO, and the read data is collected from the receive
+ * FIFO, in batches from XMC_I2C_CH_QUEUE_IRQHandler(). Completion is detected from the stop condition on the bus;
+ * a NACK ends the transaction with a stop condition, an arbitration loss or a protocol error resets the channel.
+ * Transactions run back to back without the application.
+ *
+ * \par
+ * The FIFO events and the protocol events are routed to \a service_request, whose NVIC interrupt must be enabled and
+ * call XMC_I2C_CH_QUEUE_IRQHandler(). The channel must be initialized with XMC_I2C_CH_Init() and started with
+ * XMC_I2C_CH_Start() before.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_I2C_CH_QUEUE_Submit(), XMC_I2C_CH_QUEUE_Tick(), XMC_I2C_CH_QUEUE_IsBusy() \n\n\n
+ */
+XMC_I2C_CH_STATUS_t XMC_I2C_CH_QUEUE_Init(XMC_I2C_CH_QUEUE_t *const queue,
+                                          XMC_USIC_CH_t *const channel,
+                                          const XMC_I2C_CH_QUEUE_CONFIG_t *const config);
+
+/**
+ * @param queue I2C master transaction queue state
+ * @param transaction Transaction to be queued, copied into the queue
+ * @return Status of the request.\n
+ * 			\b Range: @ref XMC_I2C_CH_STATUS_OK, @ref XMC_I2C_CH_STATUS_BUSY if the queue is full, or
+ * 			@ref XMC_I2C_CH_STATUS_ERROR if the transaction is invalid.
+ *
+ * \par<b>Description</b><br>
+ * Queues a master transaction.\n\n
+ * If the queue is idle, the transaction is started by a software triggered service request. The completion handler
+ * runs in XMC_I2C_CH_QUEUE_IRQHandler() and may submit further transactions. The buffers must stay valid until the
+ * handler has been called.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_I2C_CH_QUEUE_Init() \n\n\n
+ */
+XMC_I2C_CH_STATUS_t XMC_I2C_CH_QUEUE_Submit(XMC_I2C_CH_QUEUE_t *const queue,
+                                            const XMC_I2C_CH_TRANSACTION_t *const transaction);
+
+/**
+ * @param queue I2C master transaction queue state
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Advances the time base of the transaction timeouts.\n\n
+ * Typically called from a periodic timer interrupt. When the current transaction has been running for its timeout,
+ * the service request is triggered and XMC_I2C_CH_QUEUE_IRQHandler() aborts it with @ref XMC_I2C_CH_STATUS_TIMEOUT
+ * and resets the channel. A slave holding the clock line low must be released by the application, e.g. by clocking
+ * the bus through the port pins.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_I2C_CH_QUEUE_Submit() \n\n\n
+ */
+void XMC_I2C_CH_QUEUE_Tick(XMC_I2C_CH_QUEUE_t *const queue);
+
+/**
+ * @param queue I2C master transaction queue state
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Services the FIFO and protocol events of the transaction queue.\n\n
+ * Must be called from the interrupt handler of the service request given to XMC_I2C_CH_QUEUE_Init().
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_I2C_CH_QUEUE_Init() \n\n\n
+ */
+void XMC_I2C_CH_QUEUE_IRQHandler(XMC_I2C_CH_QUEUE_t *const queue);
+
+/**
+ * @param queue I2C master transaction queue state
+ * @return bool "true" if transactions are pending, "false" otherwise
+ *
+ * \par<b>Description</b><br>
+ * Checks if the I2C master transaction queue is busy.\n\n
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_I2C_CH_QUEUE_Submit() \n\n\n
+ */
+__STATIC_INLINE bool XMC_I2C_CH_QUEUE_IsBusy(const XMC_I2C_CH_QUEUE_t *const queue)
+{
+  return (queue->head != queue->tail);
+}
+
 #ifdef __cplusplus
 }
 #endif
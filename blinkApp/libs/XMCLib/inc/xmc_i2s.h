@@ -36,6 +36,9 @@
  * Change History
  * --------------
  *
+ * 2026-10-17:
+ *     - Added stream mode feeding the transmit FIFO from DMA ping-pong buffers, with 16, 24 and 32-bit samples <br>
+ *
  * 2015-08-21:
  *     - Initial <br>
  *
@@ -62,6 +65,7 @@
  * HEADER FILES
  *********************************************************************************************************************/
 #include "xmc_usic.h"
+#include "xmc_dma.h"
 
 /**
  * @addtogroup XMClib XMC Peripheral Library
@@ -73,6 +77,8 @@
  * @brief (IIS) driver for the XMC microcontroller family.
  *
  * USIC IIS Features: <br>
+ * -# Continuous transmission of 16, 24 and 32-bit stereo samples from DMA ping-pong buffers using XMC_I2S_CH_STREAM_Init(),
+ *    XMC_I2S_CH_STREAM_Start() and XMC_I2S_CH_STREAM_Stop() <br>
  * @{
  */
 
@@ -94,6 +100,8 @@
 #define XMC_I2S2_CH0 XMC_USIC2_CH0                   /**< USIC2 channel 0 base address */
 #define XMC_I2S2_CH1 XMC_USIC2_CH1                   /**< USIC2 channel 1 base address */
 #endif
+
+#define XMC_I2S_CH_STREAM_WORDS_PER_SAMPLE(sample_bits) (((sample_bits) > 16U) ? 2U : 1U) /**< Buffer words per sample in stream mode */
 /*******************************************************************************
  * ENUMS
  *******************************************************************************/
@@ -232,6 +240,54 @@ typedef struct XMC_I2S_CH_CONFIG
   XMC_I2S_CH_BUS_MODE_t	bus_mode;          /**< Bus mode MASTER/SLAVE */
 } XMC_I2S_CH_CONFIG_t;
 
+#if defined(GPDMA0)
+/**
+ * I2S stream buffer handler, fills a segment of \a frames stereo frames
+ */
+typedef void (*XMC_I2S_CH_STREAM_HANDLER_t)(uint16_t *data, uint32_t frames, void *context);
+
+/**
+ * I2S stream configuration
+ */
+typedef struct XMC_I2S_CH_STREAM_CONFIG
+{
+  XMC_DMA_t *dma;                       /**< GPDMA module, initialized with XMC_DMA_Init() */
+  uint16_t *buffer;                     /**< Buffer of \a num_segments * \a frames_per_segment frames */
+  XMC_DMA_LLI_t *chain;                 /**< One linked list item per segment */
+  XMC_I2S_CH_STREAM_HANDLER_t handler;  /**< Buffer handler, called for every segment to be filled */
+  void *context;                        /**< User context passed to \a handler */
+  uint32_t sample_rate;                 /**< Frames per second, e.g. 48000 */
+  uint16_t frames_per_segment;          /**< Stereo frames per segment. \b Range: 1 to 2048 buffer words per segment */
+  uint8_t num_segments;                 /**< Number of segments, two for ping-pong buffering */
+  uint8_t sample_bits;                  /**< Bits per sample. \b Range: 16, 24 or 32 */
+  uint8_t system_word_length;           /**< Shift clock cycles per sample, e.g. 32. \b Range: \a sample_bits to 64 */
+  XMC_USIC_CH_FIFO_SIZE_t tx_fifo_size; /**< Transmit FIFO size. \b Range: @ref XMC_USIC_CH_FIFO_SIZE_2WORDS.. @ref XMC_USIC_CH_FIFO_SIZE_32WORDS */
+  uint8_t tx_fifo_pointer;              /**< Start of the transmit FIFO in the USIC FIFO buffer. \b Range: 0 to 63 */
+  uint8_t tx_fifo_limit;                /**< Transmit FIFO refill level. \b Range: 1 to transmit FIFO size - 1 */
+  uint8_t dma_channel;                  /**< GPDMA channel with linked list support */
+  uint8_t dma_peripheral_request;       /**< DLR request of \a service_request, e.g. DMA0_PERIPHERAL_REQUEST_USIC0_SR0_0 */
+  uint8_t service_request;              /**< Service request line of the transmit FIFO event, routed to the GPDMA. \b Range: 0 to 5 */
+} XMC_I2S_CH_STREAM_CONFIG_t;
+
+/**
+ * I2S stream state
+ */
+typedef struct XMC_I2S_CH_STREAM
+{
+  XMC_DMA_STREAM_t stream;              /**< DMA stream from the buffer to the transmit FIFO */
+  XMC_USIC_CH_t *channel;               /**< USIC channel */
+  uint16_t *buffer;                     /**< Buffer */
+  XMC_I2S_CH_STREAM_HANDLER_t handler;  /**< Buffer handler */
+  void *context;                        /**< User context passed to \a handler */
+  uint32_t segment_words;               /**< Buffer words per segment */
+  int32_t rate_error;                   /**< Deviation of the generated sample rate in ppm */
+  uint32_t underruns;                   /**< Segments the DMA reached again before the handler had refilled them */
+  uint16_t frames_per_segment;          /**< Stereo frames per segment */
+  uint8_t num_segments;                 /**< Number of segments */
+  uint8_t service_request;              /**< Service request line of the transmit FIFO event */
+} XMC_I2S_CH_STREAM_t;
+#endif
+
 /*******************************************************************************
  * API PROTOTYPES
  *******************************************************************************/
@@ -755,6 +811,115 @@ __STATIC_INLINE void XMC_I2S_CH_DisableDelayCompensation(XMC_USIC_CH_t *const ch
   XMC_USIC_CH_DisableDelayCompensation(channel);
 }
 
+#if defined(GPDMA0)
+/**
+ * @param  handle I2S stream state
+ * @param  channel Pointer to USIC channel handler of type @ref XMC_USIC_CH_t \n
+ * 				   \b Range: @ref XMC_I2S0_CH0, @ref XMC_I2S0_CH1,@ref XMC_I2S1_CH0,@ref XMC_I2S1_CH1,@ref XMC_I2S2_CH0,@ref XMC_I2S2_CH1 @note Availability of I2S1 and I2S2 depends on device selection
+ * @param  config Buffer, sample format, FIFO layout and GPDMA routing
+ * @return Status of the initialization.\n
+ * 			\b Range: @ref XMC_I2S_CH_STATUS_OK, or @ref XMC_I2S_CH_STATUS_ERROR if the configuration is invalid or the
+ * 			sample rate cannot be generated.
+ *
+ * \par<b>Description</b><br>
+ * Initializes a continuous transmit stream.\n\n
+ * The shift clock is derived from the sample rate as \a sample_rate * 2 * \a system_word_length, and the deviation of
+ * the generated rate is stored in \a rate_error. Samples of up to 16 bits take one buffer word; 24 and 32-bit samples
+ * are sent as two words of half the sample size, most significant half first, see XMC_I2S_CH_STREAM_PutSample().
+ * A frame is the left sample followed by the right sample.
+ *
+ * \par
+ * A GPDMA linked list stream moves the buffer words into the transmit FIFO on the standard transmit FIFO event, which
+ * is routed to \a service_request and requested through the DLR; its NVIC interrupt must stay disabled. Whenever a
+ * segment has been sent, the handler is called from the GPDMA interrupt to fill it again, while the DMA continues with
+ * the next segment. If the handler falls behind, the old samples are repeated and counted by XMC_I2S_CH_STREAM_GetUnderruns(),
+ * but the shift clock and word address never stall. Since the DMA writes all words to the same FIFO input, the word
+ * address mode is disabled and left and right are given by the order in the buffer.
+ *
+ * \par
+ * The channel must be initialized as master with XMC_I2S_CH_Init() and started with XMC_I2S_CH_Start(), and the GPDMA
+ * interrupt must call XMC_DMA_IRQHandler().
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_I2S_CH_STREAM_Start(), XMC_I2S_CH_STREAM_Stop(), XMC_I2S_CH_SetSystemWordLength() \n\n\n
+ */
+XMC_I2S_CH_STATUS_t XMC_I2S_CH_STREAM_Init(XMC_I2S_CH_STREAM_t *const handle,
+                                           XMC_USIC_CH_t *const channel,
+                                           const XMC_I2S_CH_STREAM_CONFIG_t *const config);
+
+/**
+ * @param  handle I2S stream state
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Starts the transmit stream.\n\n
+ * The handler is called for every segment to fill the whole buffer, then the DMA is started.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_I2S_CH_STREAM_Stop() \n\n\n
+ */
+void XMC_I2S_CH_STREAM_Start(XMC_I2S_CH_STREAM_t *const handle);
+
+/**
+ * @param  handle I2S stream state
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Stops the transmit stream.\n\n
+ * The DMA is stopped and the transmit FIFO flushed. Call XMC_I2S_CH_STREAM_Init() again before restarting the stream.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_I2S_CH_STREAM_Start() \n\n\n
+ */
+void XMC_I2S_CH_STREAM_Stop(XMC_I2S_CH_STREAM_t *const handle);
+
+/**
+ * @param  handle I2S stream state
+ * @return uint32_t Number of segments sent again because the handler had not filled them in time
+ *
+ * \par<b>Description</b><br>
+ * Gets the underrun count of the transmit stream.\n\n
+ * The DMA runs over the linked list without waiting for the handler. A refill is counted as late when the DMA
+ * position is already back in the segment just filled, i.e. the segment went out partly with old samples.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_I2S_CH_STREAM_Init() \n\n\n
+ */
+__STATIC_INLINE uint32_t XMC_I2S_CH_STREAM_GetUnderruns(const XMC_I2S_CH_STREAM_t *const handle)
+{
+  return handle->underruns;
+}
+
+/**
+ * @param  data Buffer words of the sample
+ * @param  sample Sample, right aligned
+ * @param  sample_bits Bits per sample. \b Range: 16, 24 or 32
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Stores a sample in the buffer format of the stream mode.\n\n
+ * Samples of up to 16 bits take one word, 24 and 32-bit samples take two words with the most significant half first.
+ * The sample takes @ref XMC_I2S_CH_STREAM_WORDS_PER_SAMPLE words.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_I2S_CH_STREAM_Init() \n\n\n
+ */
+__STATIC_INLINE void XMC_I2S_CH_STREAM_PutSample(uint16_t *const data, const int32_t sample, const uint32_t sample_bits)
+{
+  uint32_t half = sample_bits >> 1U;
+
+  if (sample_bits > 16U)
+  {
+    data[0] = (uint16_t)(((uint32_t)sample >> half) & ((1UL << half) - 1U));
+    data[1] = (uint16_t)((uint32_t)sample & ((1UL << half) - 1U));
+  }
+  else
+  {
+    data[0] = (uint16_t)sample;
+  }
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -73,6 +73,7 @@
  * HEADER FILES
  *********************************************************************************************************************/
 #include "xmc_usic.h"
+#include "xmc_dma.h"
 
 /**
  * @addtogroup XMClib XMC Peripheral Library
@@ -98,6 +99,8 @@
  * -# Allows manipulation of data frame at runtime using XMC_SPI_CH_EnableSOF(), XMC_SPI_CH_EnableEOF(), 
  XMC_SPI_CH_EnableSlaveSelect(), XMC_SPI_CH_DisableSlaveSelect()
  * -# Provides APIs for transmitting data and receiving data using XMC_SPI_CH_Transmit(), XMC_SPI_CH_Receive(), XMC_SPI_CH_GetReceivedData()
+ * -# Provides block transfers through the FIFOs using XMC_SPI_CH_Transfer()
+ * -# Provides a queue of DMA transactions to several slaves using XMC_SPI_CH_DMA_QUEUE_Init(), XMC_SPI_CH_DMA_QUEUE_Submit()
  * -# Allows configuration of shift clock using XMC_SPI_CH_ConfigureShiftClockOutput()
  * -# Provides enumeration of SPI protocol events using @ref XMC_SPI_CH_STATUS_FLAG_t
  * @{
@@ -315,6 +318,72 @@ typedef struct XMC_SPI_CH_CONFIG
   XMC_USIC_CH_PARITY_MODE_t parity_mode;          /**< Enable parity check for transmit and received data */
 } XMC_SPI_CH_CONFIG_t;
 
+#if defined(GPDMA0)
+/**
+ * SPI DMA transaction completion handler
+ */
+typedef void (*XMC_SPI_CH_DMA_HANDLER_t)(XMC_SPI_CH_STATUS_t status, void *context);
+
+/**
+ * SPI DMA transaction, the slave select, clock and data settings are applied before the transfer starts
+ */
+typedef struct XMC_SPI_CH_DMA_TRANSACTION
+{
+  const void *tx_data;                                  /**< Data to transmit, NULL to transmit dummy data(FFFFH) */
+  void *rx_data;                                        /**< Buffer for the received data, NULL to discard it */
+  XMC_SPI_CH_DMA_HANDLER_t handler;                     /**< Completion handler, optional */
+  void *context;                                        /**< User context passed to \a handler */
+  uint32_t baudrate;                                    /**< Shift clock rate */
+  XMC_SPI_CH_SLAVE_SELECT_t slave;                      /**< Slave select output */
+  XMC_SPI_CH_MODE_t mode;                               /**< Data line mode, half duplex modes transfer in one direction */
+  XMC_SPI_CH_BRG_SHIFT_CLOCK_PASSIVE_LEVEL_t clock_mode; /**< Shift clock passive level and delay */
+  uint16_t count;                                       /**< Number of data words. \b Range: 1 to 2048 */
+  uint8_t word_length;                                  /**< Data word length in bits, byte buffers up to 8, else 16-bit buffers. \b Range: 1 to 16 */
+} XMC_SPI_CH_DMA_TRANSACTION_t;
+
+/**
+ * SPI DMA transaction queue configuration
+ */
+typedef struct XMC_SPI_CH_DMA_QUEUE_CONFIG
+{
+  XMC_DMA_t *dma;                               /**< GPDMA module, initialized with XMC_DMA_Init() */
+  XMC_SPI_CH_DMA_TRANSACTION_t *transactions;   /**< Queue storage */
+  uint8_t size;                                 /**< Number of queue entries, one is kept free */
+  uint8_t tx_channel;                           /**< GPDMA channel feeding the transmit buffer */
+  uint8_t rx_channel;                           /**< GPDMA channel draining the receive buffer */
+  uint8_t tx_peripheral_request;                /**< DLR request of \a tx_service_request, e.g. DMA0_PERIPHERAL_REQUEST_USIC0_SR0_0 */
+  uint8_t rx_peripheral_request;                /**< DLR request of \a rx_service_request */
+  uint8_t tx_service_request;                   /**< Service request line of the transmit buffer event. \b Range: 0 to 5 */
+  uint8_t rx_service_request;                   /**< Service request line of the receive events. \b Range: 0 to 5 */
+} XMC_SPI_CH_DMA_QUEUE_CONFIG_t;
+
+/**
+ * SPI DMA transaction queue state
+ */
+typedef struct XMC_SPI_CH_DMA_QUEUE
+{
+  XMC_USIC_CH_t *channel;                               /**< USIC channel */
+  XMC_DMA_t *dma;                                       /**< GPDMA module */
+  XMC_SPI_CH_DMA_TRANSACTION_t *transactions;           /**< Queue storage */
+  uint32_t baudrate;                                    /**< Programmed shift clock rate, 0 if none */
+  uint32_t reconfigurations;                            /**< Transactions that needed a new baud rate */
+  uint16_t tx_dummy;                                    /**< Transmitted if a transaction has no transmit data */
+  uint16_t rx_dummy;                                    /**< Receives data a transaction discards */
+  XMC_SPI_CH_BRG_SHIFT_CLOCK_PASSIVE_LEVEL_t clock_mode; /**< Programmed shift clock passive level */
+  uint8_t word_length;                                  /**< Programmed word length, 0 before the first transaction */
+  uint8_t tx_channel;                                   /**< Transmit GPDMA channel */
+  uint8_t rx_channel;                                   /**< Receive GPDMA channel */
+  uint8_t tx_peripheral_request;                        /**< DLR request of the transmit buffer event */
+  uint8_t rx_peripheral_request;                        /**< DLR request of the receive events */
+  uint8_t tx_service_request;                           /**< Service request line of the transmit buffer event */
+  uint8_t size;                                         /**< Number of queue entries */
+  uint8_t head;                                         /**< Next entry to fill */
+  uint8_t tail;                                         /**< Oldest entry, in transfer if \a active is set */
+  bool active;                                          /**< Queue running, set until it is empty */
+  bool in_transfer;                                     /**< GPDMA channels programmed, cleared by the first completion or error */
+} XMC_SPI_CH_DMA_QUEUE_t;
+#endif
+
 /**********************************************************************************************************************
  * API PROTOTYPES
  *********************************************************************************************************************/
@@ -495,6 +564,40 @@ __STATIC_INLINE void XMC_SPI_CH_Receive(XMC_USIC_CH_t *const channel, const XMC_
  */
 uint16_t XMC_SPI_CH_GetReceivedData(XMC_USIC_CH_t *const channel);
 
+/**
+ * @param channel A constant pointer to XMC_USIC_CH_t, pointing to the USIC channel base address.
+ * @param tx_data Data to be transmitted, NULL to transmit dummy data(FFFFH)
+ * @param rx_data Buffer for the received data, NULL to discard it
+ * @param count Number of data words
+ * @param mode Communication mode of the SPI, based on this mode TCI(Transmit control information)is updated.\n
+ *             Refer @ref XMC_SPI_CH_MODE_t for valid values.
+ *
+ * @return XMC_SPI_CH_STATUS_t ::XMC_SPI_CH_STATUS_OK, or ::XMC_SPI_CH_STATUS_ERROR if the transmit or receive
+ *         FIFO is not configured, or if both \a tx_data and \a rx_data are given in a half duplex mode.
+ *
+ * \par<b>Description:</b><br>
+ * Transfers a block of data words through the transmit and receive FIFOs.\n\n
+ * The transmit FIFO is kept filled while the receive FIFO is drained in bursts, so the shift clock runs without
+ * gaps between words. Each pass reads the FIFO filling levels once and moves as many words as they allow. The number
+ * of words in flight is limited to the receive FIFO size, so that received data is never lost; the receive FIFO
+ * should be at least as large as the transmit FIFO. Data words of up to 8 bits are taken from and stored to byte
+ * buffers, longer words from and to 16-bit buffers, depending on the configured word length.
+ *
+ * \par
+ * In the half duplex, dual and quad modes a transfer either transmits (\a rx_data is NULL) or receives (\a tx_data
+ * is NULL). A transmit returns once the last word has left the transmit buffer, and the receive FIFO is flushed. In
+ * standard full duplex mode the function returns when the last word has been received. The FIFOs must be configured
+ * with XMC_USIC_CH_TXFIFO_Configure() and XMC_USIC_CH_RXFIFO_Configure() before, and their events should be disabled.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_SPI_CH_Transmit(), XMC_SPI_CH_Receive(), XMC_SPI_CH_SetWordLength()
+ */
+XMC_SPI_CH_STATUS_t XMC_SPI_CH_Transfer(XMC_USIC_CH_t *const channel,
+                                        const void *const tx_data,
+                                        void *const rx_data,
+                                        const uint32_t count,
+                                        const XMC_SPI_CH_MODE_t mode);
+
 /**
  * @param channel A constant pointer to XMC_USIC_CH_t, pointing to the USIC channel base address.
  *
@@ -1170,6 +1273,73 @@ __STATIC_INLINE void XMC_SPI_CH_ConfigExternalInputSignalToBRG(XMC_USIC_CH_t *co
   XMC_USIC_CH_ConfigExternalInputSignalToBRG(channel,pdiv,2U,combination_mode);
 }
 
+#if defined(GPDMA0)
+/**
+ * @param queue SPI DMA transaction queue state
+ * @param channel A constant pointer to XMC_USIC_CH_t, pointing to the USIC channel base address.
+ * @param config Queue storage, GPDMA channels and request routing
+ *
+ * @return XMC_SPI_CH_STATUS_t ::XMC_SPI_CH_STATUS_OK, or ::XMC_SPI_CH_STATUS_ERROR if the GPDMA module is not
+ *         enabled or the configuration is invalid.
+ *
+ * \par<b>Description:</b><br>
+ * Initializes a queue of DMA transactions on a master channel.\n\n
+ * Several slaves with different clock rates and word lengths can share the channel. Every transaction carries its
+ * slave select output, baud rate, shift clock mode, data line mode and buffers. When a transaction completes, the
+ * receive GPDMA channel interrupt ends the frame and starts the next transaction, so the queue runs back to back
+ * without the application. The baud rate, shift clock and word length are only reprogrammed when they differ from
+ * the previous transaction.
+ *
+ * \par
+ * The transmit buffer event is routed to \a tx_service_request and the receive events to \a rx_service_request;
+ * both request their GPDMA channel through the DLR and their NVIC interrupts must stay disabled. The receive channel
+ * runs for every transaction, also when the received data is discarded, and its completion marks the end of the last
+ * word. The channel must be initialized with XMC_SPI_CH_Init() with a frame length of 64, its FIFOs must be disabled,
+ * and the GPDMA interrupt must call XMC_DMA_IRQHandler().
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_SPI_CH_DMA_QUEUE_Submit(), XMC_SPI_CH_DMA_QUEUE_IsBusy()
+ */
+XMC_SPI_CH_STATUS_t XMC_SPI_CH_DMA_QUEUE_Init(XMC_SPI_CH_DMA_QUEUE_t *const queue,
+                                              XMC_USIC_CH_t *const channel,
+                                              const XMC_SPI_CH_DMA_QUEUE_CONFIG_t *const config);
+
+/**
+ * @param queue SPI DMA transaction queue state
+ * @param transaction Transaction to be queued, copied into the queue
+ *
+ * @return XMC_SPI_CH_STATUS_t ::XMC_SPI_CH_STATUS_OK, ::XMC_SPI_CH_STATUS_BUSY if the queue is full, or
+ *         ::XMC_SPI_CH_STATUS_ERROR if the transaction is invalid.
+ *
+ * \par<b>Description:</b><br>
+ * Queues a DMA transaction.\n\n
+ * If the queue is idle, the transaction starts before the function returns. Otherwise it starts from the GPDMA
+ * interrupt when the transactions before it have completed. The completion handler runs in the GPDMA interrupt and
+ * may submit further transactions. The buffers must stay valid until the handler has been called.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_SPI_CH_DMA_QUEUE_Init()
+ */
+XMC_SPI_CH_STATUS_t XMC_SPI_CH_DMA_QUEUE_Submit(XMC_SPI_CH_DMA_QUEUE_t *const queue,
+                                                const XMC_SPI_CH_DMA_TRANSACTION_t *const transaction);
+
+/**
+ * @param queue SPI DMA transaction queue state
+ *
+ * @return bool "true" if transactions are pending, "false" otherwise
+ *
+ * \par<b>Description:</b><br>
+ * Checks if the SPI DMA transaction queue is busy.\n\n
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_SPI_CH_DMA_QUEUE_Submit()
+ */
+__STATIC_INLINE bool XMC_SPI_CH_DMA_QUEUE_IsBusy(const XMC_SPI_CH_DMA_QUEUE_t *const queue)
+{
+  return (queue->head != queue->tail);
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
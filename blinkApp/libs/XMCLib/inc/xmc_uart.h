@@ -62,6 +62,8 @@
  *********************************************************************************************************************/
 
 #include "xmc_usic.h"
+#include "xmc_dma.h"
+#include "xmc_fce.h"
 
 /**
  * @addtogroup XMClib XMC Peripheral Library
@@ -85,6 +87,11 @@
  XMC_UART_CH_SetWordLength() and XMC_UART_CH_SetFrameLength()
  * -# Provides the status of UART protocol events, XMC_UART_CH_GetStatusFlag()
  * -# Allows transmission of data using XMC_UART_CH_Transmit() and gets received data using XMC_UART_CH_GetReceivedData()
+ * -# Interrupt driven buffered mode on the USIC FIFOs, XMC_UART_CH_BUFFERED_Init(), XMC_UART_CH_BUFFERED_Write(),
+ XMC_UART_CH_BUFFERED_Read() and XMC_UART_CH_BUFFERED_IRQHandler()
+ * -# DMA receive into a circular buffer with message delivery on an end of message event, XMC_UART_CH_DMA_RX_Init()
+ * -# COBS or SLIP framed mode on top of the buffered mode with an optional FCE CRC trailer, XMC_UART_CH_FRAMED_Init(),
+ XMC_UART_CH_FRAMED_Send() and XMC_UART_CH_FRAMED_IRQHandler()
  * 
  * @{
  */
@@ -202,6 +209,15 @@ typedef enum XMC_UART_CH_INTERRUPT_NODE_POINTER
   XMC_UART_CH_INTERRUPT_NODE_POINTER_PROTOCOL            = XMC_USIC_CH_INTERRUPT_NODE_POINTER_PROTOCOL   /**< Node pointer for protocol related interrupts */
 } XMC_UART_CH_INTERRUPT_NODE_POINTER_t;
 
+/**
+ * UART framed mode encoding
+ */
+typedef enum XMC_UART_CH_FRAMING
+{
+  XMC_UART_CH_FRAMING_COBS, /**< Consistent overhead byte stuffing, frames are delimited by 0x00 */
+  XMC_UART_CH_FRAMING_SLIP  /**< Serial line IP (RFC 1055), frames are delimited by 0xC0 */
+} XMC_UART_CH_FRAMING_t;
+
 /*********************************************************************************************************************
  * DATA STRUCTURES
  *********************************************************************************************************************/
@@ -222,6 +238,133 @@ typedef struct XMC_UART_CH_CONFIG
                                                   @ref XMC_USIC_CH_PARITY_MODE_ODD*/
 } XMC_UART_CH_CONFIG_t;
 
+/**
+ * UART buffered mode software ring. The producer only writes \a head and the consumer only writes \a tail,
+ * so one side may run in the interrupt and the other in thread context without locking.
+ */
+typedef struct XMC_UART_CH_RING
+{
+  uint8_t *buffer;        /**< Ring storage */
+  uint32_t mask;          /**< Ring size - 1, the size is a power of two */
+  volatile uint32_t head; /**< Free running write index */
+  volatile uint32_t tail; /**< Free running read index */
+} XMC_UART_CH_RING_t;
+
+/**
+ * UART buffered mode configuration. Both channels of a USIC module share 64 FIFO words, so the FIFO
+ * regions of the two channels must not overlap.
+ */
+typedef struct XMC_UART_CH_BUFFERED_CONFIG
+{
+  uint8_t *tx_buffer;                    /**< Transmit ring storage */
+  uint8_t *rx_buffer;                    /**< Receive ring storage */
+  uint32_t tx_buffer_size;               /**< Transmit ring size in bytes, a power of two */
+  uint32_t rx_buffer_size;               /**< Receive ring size in bytes, a power of two */
+  XMC_USIC_CH_FIFO_SIZE_t tx_fifo_size;  /**< Transmit FIFO size. \b Range: @ref XMC_USIC_CH_FIFO_SIZE_2WORDS.. @ref XMC_USIC_CH_FIFO_SIZE_32WORDS */
+  XMC_USIC_CH_FIFO_SIZE_t rx_fifo_size;  /**< Receive FIFO size. \b Range: @ref XMC_USIC_CH_FIFO_SIZE_2WORDS.. @ref XMC_USIC_CH_FIFO_SIZE_32WORDS */
+  uint8_t tx_fifo_pointer;               /**< Start of the transmit FIFO in the USIC FIFO buffer. \b Range: 0 to 63 */
+  uint8_t rx_fifo_pointer;               /**< Start of the receive FIFO in the USIC FIFO buffer. \b Range: 0 to 63 */
+  uint8_t tx_fifo_limit;                 /**< Transmit FIFO refill level. \b Range: 0 to transmit FIFO size - 1 */
+  uint8_t rx_fifo_limit;                 /**< Receive FIFO drain level. \b Range: 0 to receive FIFO size - 1 */
+  uint8_t service_request;               /**< Service request line of the transmit and receive FIFO events. \b Range: 0 to 5 */
+} XMC_UART_CH_BUFFERED_CONFIG_t;
+
+/**
+ * UART buffered mode state
+ */
+typedef struct XMC_UART_CH_BUFFERED
+{
+  XMC_USIC_CH_t *channel;   /**< USIC channel */
+  XMC_UART_CH_RING_t tx;    /**< Transmit ring, written by the application */
+  XMC_UART_CH_RING_t rx;    /**< Receive ring, written by the interrupt */
+  uint32_t tx_fifo_size;    /**< Transmit FIFO size in words */
+  uint32_t rx_overruns;     /**< Received words dropped because the receive ring was full */
+  uint8_t service_request;  /**< Service request line of the FIFO events */
+  volatile bool tx_idle;    /**< Transmit FIFO refill needs a software triggered service request */
+} XMC_UART_CH_BUFFERED_t;
+
+/**
+ * UART framed mode frame handler. \a data holds the decoded frame without the CRC trailer and is only valid
+ * during the call.
+ */
+typedef void (*XMC_UART_CH_FRAME_HANDLER_t)(uint8_t *data, uint32_t size, void *context);
+
+/**
+ * UART framed mode configuration
+ */
+typedef struct XMC_UART_CH_FRAMED_CONFIG
+{
+  XMC_UART_CH_BUFFERED_CONFIG_t buffered; /**< Rings and FIFOs carrying the encoded frames, with a receive FIFO limit of 0 */
+  uint8_t *frame_buffer;                  /**< Receive frame buffer */
+  uint32_t frame_buffer_size;             /**< Receive frame buffer size, at least the longest encoded frame plus its delimiter */
+  XMC_UART_CH_FRAME_HANDLER_t handler;    /**< Frame handler, called from XMC_UART_CH_FRAMED_IRQHandler() */
+  void *context;                          /**< User context passed to \a handler */
+#if defined(FCE)
+  const XMC_FCE_t *crc;                   /**< FCE kernel of the CRC trailer, initialized with XMC_FCE_Init(), NULL for none */
+#endif
+  XMC_UART_CH_FRAMING_t framing;          /**< Frame encoding */
+} XMC_UART_CH_FRAMED_CONFIG_t;
+
+/**
+ * UART framed mode state
+ */
+typedef struct XMC_UART_CH_FRAMED
+{
+  XMC_UART_CH_BUFFERED_t buffered;        /**< Buffered mode carrying the encoded frames */
+  uint8_t *frame;                         /**< Receive frame buffer */
+  uint32_t frame_size;                    /**< Receive frame buffer size */
+  uint32_t length;                        /**< Received bytes of the current frame */
+  XMC_UART_CH_FRAME_HANDLER_t handler;    /**< Frame handler */
+  void *context;                          /**< User context passed to \a handler */
+  uint32_t rx_errors;                     /**< Received frames dropped because of encoding, length or CRC errors */
+#if defined(FCE)
+  const XMC_FCE_t *crc;                   /**< FCE kernel of the CRC trailer */
+#endif
+  XMC_UART_CH_FRAMING_t framing;          /**< Frame encoding */
+  uint8_t crc_size;                       /**< CRC trailer size in bytes, 0 for none */
+  bool discard;                           /**< Current frame overflowed the frame buffer and is dropped */
+} XMC_UART_CH_FRAMED_t;
+
+#if defined(GPDMA0)
+/**
+ * UART DMA receive data handler. \a data points into the circular buffer and stays valid until the DMA
+ * wraps around to it.
+ */
+typedef void (*XMC_UART_CH_DMA_RX_HANDLER_t)(const uint8_t *data, uint32_t size, void *context);
+
+/**
+ * UART DMA receive configuration
+ */
+typedef struct XMC_UART_CH_DMA_RX_CONFIG
+{
+  XMC_DMA_t *dma;                       /**< GPDMA module, initialized with XMC_DMA_Init() */
+  uint8_t *buffer;                      /**< Circular buffer of \a num_segments * \a segment_size bytes */
+  XMC_DMA_LLI_t *chain;                 /**< One linked list item per segment, NULL for a single auto-reloaded segment */
+  XMC_UART_CH_DMA_RX_HANDLER_t handler; /**< Receive data handler */
+  void *context;                        /**< User context passed to \a handler */
+  uint32_t message_event;               /**< Protocol events ending a message, @ref XMC_UART_CH_EVENT_t, 0 for none */
+  uint16_t segment_size;                /**< Segment size in bytes. \b Range: 1 to 2048 */
+  uint8_t num_segments;                 /**< Number of segments, one without \a chain */
+  uint8_t dma_channel;                  /**< GPDMA0 channel. \b Range: 0 or 1 */
+  uint8_t dma_peripheral_request;       /**< DLR request of \a receive_service_request, e.g. DMA0_PERIPHERAL_REQUEST_USIC0_SR0_0 */
+  uint8_t receive_service_request;      /**< Service request line of the receive events, routed to the GPDMA. \b Range: 0 to 5 */
+  uint8_t message_service_request;      /**< Service request line of \a message_event. \b Range: 0 to 5 */
+} XMC_UART_CH_DMA_RX_CONFIG_t;
+
+/**
+ * UART DMA receive state
+ */
+typedef struct XMC_UART_CH_DMA_RX
+{
+  XMC_DMA_STREAM_t stream;              /**< DMA stream from the receive buffer to the circular buffer */
+  XMC_USIC_CH_t *channel;               /**< USIC channel */
+  XMC_UART_CH_DMA_RX_HANDLER_t handler; /**< Receive data handler */
+  void *context;                        /**< User context passed to \a handler */
+  uint32_t size;                        /**< Circular buffer size in bytes */
+  uint32_t read;                        /**< Offset of the first byte not yet passed to \a handler */
+} XMC_UART_CH_DMA_RX_t;
+#endif
+
 /*********************************************************************************************************************
  * API PROTOTYPES
  *********************************************************************************************************************/
@@ -754,6 +897,307 @@ __STATIC_INLINE void XMC_UART_CH_SetInputSamplingFreq(XMC_USIC_CH_t *const chann
   XMC_USIC_CH_SetInputSamplingFreq(channel, (XMC_USIC_CH_INPUT_t)input, (XMC_USIC_CH_INPUT_SAMPLING_FREQ_t)sampling_freq);
 }
 
+/**
+ * @param handle UART buffered mode state
+ * @param channel Constant pointer to USIC channel handle of type @ref XMC_USIC_CH_t \n
+ * 				  \b Range: @ref XMC_UART0_CH0, @ref XMC_UART0_CH1,@ref XMC_UART1_CH0,@ref XMC_UART1_CH1,@ref XMC_UART2_CH0,@ref XMC_UART2_CH1 @note Availability of UART1 and UART2 depends on device selection
+ * @param config Constant pointer to buffered mode configuration of type @ref XMC_UART_CH_BUFFERED_CONFIG_t.
+ * @return XMC_UART_CH_STATUS_t Status of the buffered mode initialization.\n
+ *          \b Range: @ref XMC_UART_CH_STATUS_OK if initialization is successful.\n
+ *                    @ref XMC_UART_CH_STATUS_ERROR if a ring size is not a power of two or a FIFO limit is out of range.
+ *
+ * \par<b>Description</b><br>
+ * Initializes the interrupt driven buffered mode of a UART channel.\n\n
+ * The transmit and receive FIFOs are configured with XMC_USIC_CH_TXFIFO_Configure() and XMC_USIC_CH_RXFIFO_Configure(),
+ * and the standard transmit, standard receive and alternative receive FIFO events are routed to \a service_request.
+ * The application writes to the transmit ring and reads from the receive ring; XMC_UART_CH_BUFFERED_IRQHandler()
+ * moves data between the rings and the FIFOs, as many words per interrupt as the FIFO levels allow.
+ * A receive FIFO limit of 0 passes every word on as soon as possible; a higher limit takes fewer interrupts,
+ * but words below the limit stay in the FIFO until more data arrives.
+ * The buffered mode transfers data words of up to 8 bits. The channel must be initialized with XMC_UART_CH_Init()
+ * before, and the NVIC interrupt of \a service_request must be enabled and call XMC_UART_CH_BUFFERED_IRQHandler().
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_Init(), XMC_UART_CH_BUFFERED_Write(), XMC_UART_CH_BUFFERED_Read()\n\n\n
+ */
+XMC_UART_CH_STATUS_t XMC_UART_CH_BUFFERED_Init(XMC_UART_CH_BUFFERED_t *const handle,
+                                               XMC_USIC_CH_t *const channel,
+                                               const XMC_UART_CH_BUFFERED_CONFIG_t *const config);
+
+/**
+ * @param handle UART buffered mode state
+ * @param data Data to transmit
+ * @param size Number of bytes to transmit
+ * @return uint32_t Number of bytes accepted, less than \a size if the transmit ring is full
+ *
+ * \par<b>Description</b><br>
+ * Queues data for transmission without waiting.\n\n
+ * The data is copied to the transmit ring. If the transmit FIFO has run empty, the service request is triggered
+ * by software so that the interrupt refills the FIFO. Only one context may write to a channel.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_BUFFERED_GetTxFree(), XMC_UART_CH_BUFFERED_IsTxIdle()\n\n\n
+ */
+uint32_t XMC_UART_CH_BUFFERED_Write(XMC_UART_CH_BUFFERED_t *const handle, const uint8_t *const data, const uint32_t size);
+
+/**
+ * @param handle UART buffered mode state
+ * @param data Buffer for the received data
+ * @param size Size of \a data in bytes
+ * @return uint32_t Number of bytes copied to \a data
+ *
+ * \par<b>Description</b><br>
+ * Reads received data without waiting.\n\n
+ * Up to \a size bytes are copied from the receive ring. Only one context may read from a channel.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_BUFFERED_GetRxCount()\n\n\n
+ */
+uint32_t XMC_UART_CH_BUFFERED_Read(XMC_UART_CH_BUFFERED_t *const handle, uint8_t *const data, const uint32_t size);
+
+/**
+ * @param handle UART buffered mode state
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Services the transmit and receive FIFOs of a buffered mode channel.\n\n
+ * The receive FIFO is drained into the receive ring and the transmit FIFO is refilled from the transmit ring.
+ * The FIFO filling level is read once per batch, so each word costs a single register access. Words received
+ * while the receive ring is full are dropped and counted. Call the function from the interrupt handler of the
+ * configured service request.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_BUFFERED_Init()\n\n\n
+ */
+void XMC_UART_CH_BUFFERED_IRQHandler(XMC_UART_CH_BUFFERED_t *const handle);
+
+/**
+ * @param handle UART buffered mode state
+ * @return uint32_t Number of received bytes waiting in the receive ring
+ *
+ * \par<b>Description</b><br>
+ * Gets the number of bytes XMC_UART_CH_BUFFERED_Read() can return.\n\n
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_BUFFERED_Read()\n\n\n
+ */
+__STATIC_INLINE uint32_t XMC_UART_CH_BUFFERED_GetRxCount(const XMC_UART_CH_BUFFERED_t *const handle)
+{
+  return (handle->rx.head - handle->rx.tail);
+}
+
+/**
+ * @param handle UART buffered mode state
+ * @return uint32_t Number of bytes XMC_UART_CH_BUFFERED_Write() can accept
+ *
+ * \par<b>Description</b><br>
+ * Gets the free space of the transmit ring.\n\n
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_BUFFERED_Write()\n\n\n
+ */
+__STATIC_INLINE uint32_t XMC_UART_CH_BUFFERED_GetTxFree(const XMC_UART_CH_BUFFERED_t *const handle)
+{
+  return ((handle->tx.mask + 1U) - (handle->tx.head - handle->tx.tail));
+}
+
+/**
+ * @param handle UART buffered mode state
+ * @return bool "true" if the transmit ring and FIFO are empty, "false" otherwise
+ *
+ * \par<b>Description</b><br>
+ * Checks if all queued data has been passed to the shift register.\n\n
+ * The last word may still be in transmission, see @ref XMC_UART_CH_STATUS_FLAG_TRANSMISSION_IDLE.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_BUFFERED_Write()\n\n\n
+ */
+__STATIC_INLINE bool XMC_UART_CH_BUFFERED_IsTxIdle(const XMC_UART_CH_BUFFERED_t *const handle)
+{
+  return ((handle->tx.head == handle->tx.tail) && XMC_USIC_CH_TXFIFO_IsEmpty(handle->channel));
+}
+
+/**
+ * @param handle UART framed mode state
+ * @param channel Constant pointer to USIC channel handle of type @ref XMC_USIC_CH_t \n
+ * 				  \b Range: @ref XMC_UART0_CH0, @ref XMC_UART0_CH1,@ref XMC_UART1_CH0,@ref XMC_UART1_CH1,@ref XMC_UART2_CH0,@ref XMC_UART2_CH1 @note Availability of UART1 and UART2 depends on device selection
+ * @param config Constant pointer to framed mode configuration of type @ref XMC_UART_CH_FRAMED_CONFIG_t.
+ * @return XMC_UART_CH_STATUS_t Status of the framed mode initialization.\n
+ *          \b Range: @ref XMC_UART_CH_STATUS_OK if initialization is successful.\n
+ *                    @ref XMC_UART_CH_STATUS_ERROR if the buffered mode configuration is invalid, the receive FIFO limit is not 0 or the
+ *                    handler is missing.
+ *
+ * \par<b>Description</b><br>
+ * Initializes the framed mode of a UART channel.\n\n
+ * Frames are COBS or SLIP encoded into the transmit ring of the buffered mode, see XMC_UART_CH_BUFFERED_Init(), with a
+ * delimiter before and after each frame. On receive, the FIFO events move the data into the frame buffer, which is
+ * searched for the delimiter; every complete frame is decoded in place and passed to the handler. Frame data is
+ * scanned four bytes at a time and runs without special bytes are copied as a block, so the byte loop only runs
+ * around delimiters and escapes. The receive ring only buffers a FIFO batch and can be small.
+ *
+ * \par
+ * With \a crc set, a trailer of 1, 2 or 4 bytes, depending on the FCE kernel, is appended to each frame and checked
+ * on receive. The CRC is calculated over the payload zero padded to the input width of the kernel, and stored least
+ * significant byte first. The kernel may be shared between the transmit and receive context; each calculation runs
+ * with interrupts disabled. Frames failing the decoding or the CRC check, and frames longer than the frame buffer,
+ * are dropped and counted, see XMC_UART_CH_FRAMED_GetRxErrors().
+ *
+ * \par
+ * The NVIC interrupt of the service request must call XMC_UART_CH_FRAMED_IRQHandler() instead of
+ * XMC_UART_CH_BUFFERED_IRQHandler().
+ *
+ * \par
+ * Frames are only searched on a receive FIFO event and the UART has no receiver idle event, so the last bytes of a
+ * frame would stay in the FIFO with a higher limit. The receive FIFO limit of \a buffered must therefore be 0, so
+ * that the event is raised for every received byte.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_BUFFERED_Init(), XMC_UART_CH_FRAMED_Send()\n\n\n
+ */
+XMC_UART_CH_STATUS_t XMC_UART_CH_FRAMED_Init(XMC_UART_CH_FRAMED_t *const handle,
+                                             XMC_USIC_CH_t *const channel,
+                                             const XMC_UART_CH_FRAMED_CONFIG_t *const config);
+
+/**
+ * @param handle UART framed mode state
+ * @param data Frame payload
+ * @param size Payload size in bytes
+ * @return XMC_UART_CH_STATUS_t Status of the operation.\n
+ *          \b Range: @ref XMC_UART_CH_STATUS_OK if the frame has been queued.\n
+ *                    @ref XMC_UART_CH_STATUS_BUSY if the transmit ring cannot hold the encoded frame.
+ *
+ * \par<b>Description</b><br>
+ * Encodes and queues a frame for transmission without waiting.\n\n
+ * The frame is queued completely or not at all. The transmit ring must hold at least \a size + 1/254 overhead + 3
+ * bytes for COBS and 2 * \a size + 2 bytes for SLIP, each plus the CRC trailer. Only one context may send on a channel.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_FRAMED_Init(), XMC_UART_CH_BUFFERED_IsTxIdle()\n\n\n
+ */
+XMC_UART_CH_STATUS_t XMC_UART_CH_FRAMED_Send(XMC_UART_CH_FRAMED_t *const handle, const uint8_t *const data, const uint32_t size);
+
+/**
+ * @param handle UART framed mode state
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Services the FIFOs of a framed mode channel and delivers the received frames.\n\n
+ * Call the function from the interrupt handler of the configured service request.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_FRAMED_Init()\n\n\n
+ */
+void XMC_UART_CH_FRAMED_IRQHandler(XMC_UART_CH_FRAMED_t *const handle);
+
+/**
+ * @param handle UART framed mode state
+ * @return uint32_t Number of dropped receive frames
+ *
+ * \par<b>Description</b><br>
+ * Gets the number of received frames dropped because of encoding, length or CRC errors.\n\n
+ * Bytes lost in a full receive ring are counted by the buffered mode in addition.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_FRAMED_IRQHandler()\n\n\n
+ */
+__STATIC_INLINE uint32_t XMC_UART_CH_FRAMED_GetRxErrors(const XMC_UART_CH_FRAMED_t *const handle)
+{
+  return handle->rx_errors;
+}
+
+#if defined(GPDMA0)
+/**
+ * @param handle UART DMA receive state
+ * @param channel Constant pointer to USIC channel handle of type @ref XMC_USIC_CH_t \n
+ * 				  \b Range: @ref XMC_UART0_CH0, @ref XMC_UART0_CH1,@ref XMC_UART1_CH0,@ref XMC_UART1_CH1,@ref XMC_UART2_CH0,@ref XMC_UART2_CH1 @note Availability of UART1 and UART2 depends on device selection
+ * @param config Constant pointer to DMA receive configuration of type @ref XMC_UART_CH_DMA_RX_CONFIG_t.
+ * @return XMC_UART_CH_STATUS_t Status of the DMA receive initialization.\n
+ *          \b Range: @ref XMC_UART_CH_STATUS_OK if initialization is successful.\n
+ *                    @ref XMC_UART_CH_STATUS_ERROR if the DMA stream could not be initialized.
+ *
+ * \par<b>Description</b><br>
+ * Initializes DMA reception of a UART channel into a circular buffer.\n\n
+ * The standard and alternative receive events are enabled with XMC_UART_CH_EnableEvent() and routed to
+ * \a receive_service_request, which requests the GPDMA channel through the DLR. The channel runs as a
+ * continuous ::XMC_DMA_STREAM_t: byte transfers from RBUF into the buffer, auto-reloaded or over a looping
+ * linked list, so it never has to be restarted. Both need GPDMA0 channel 0 or 1 as \a dma_channel, other
+ * channels return @ref XMC_UART_CH_STATUS_ERROR. Received data is passed to the handler at every segment
+ * end, and when \a message_event occurs.
+ *
+ * \par
+ * The USIC has no receiver idle interrupt in UART mode. A message end is signalled either by a protocol event
+ * such as @ref XMC_UART_CH_EVENT_SYNCHRONIZATION_BREAK, or by a timer running XMC_UART_CH_DMA_RX_Flush()
+ * after the line has been idle for some character times. The CPU is thus interrupted once per message and
+ * segment instead of once per byte.
+ *
+ * \par
+ * The receive FIFO must be disabled. The GPDMA interrupt must call XMC_DMA_IRQHandler() and the NVIC interrupt
+ * of \a message_service_request must call XMC_UART_CH_DMA_RX_IRQHandler(); both, and a timer calling
+ * XMC_UART_CH_DMA_RX_Flush(), must share one interrupt priority. The NVIC interrupt of \a receive_service_request
+ * must stay disabled.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_DMA_RX_Start(), XMC_UART_CH_DMA_RX_Flush(), XMC_DMA_STREAM_Init()\n\n\n
+ */
+XMC_UART_CH_STATUS_t XMC_UART_CH_DMA_RX_Init(XMC_UART_CH_DMA_RX_t *const handle,
+                                             XMC_USIC_CH_t *const channel,
+                                             const XMC_UART_CH_DMA_RX_CONFIG_t *const config);
+
+/**
+ * @param handle UART DMA receive state
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Starts DMA reception at the beginning of the circular buffer.\n\n
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_DMA_RX_Stop()\n\n\n
+ */
+void XMC_UART_CH_DMA_RX_Start(XMC_UART_CH_DMA_RX_t *const handle);
+
+/**
+ * @param handle UART DMA receive state
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Stops DMA reception.\n\n
+ * Data received so far is passed to the handler first. Call XMC_UART_CH_DMA_RX_Init() again before restarting.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_DMA_RX_Start()\n\n\n
+ */
+void XMC_UART_CH_DMA_RX_Stop(XMC_UART_CH_DMA_RX_t *const handle);
+
+/**
+ * @param handle UART DMA receive state
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Passes the data received since the last call to the handler.\n\n
+ * The fill position is read from the GPDMA channel, so a partly filled segment is delivered as well. At the end
+ * of the buffer the data is passed in two calls. The read index is advanced with interrupts disabled before the
+ * handler runs, so the function may also be called from thread context; no data is then passed twice.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_DMA_RX_IRQHandler()\n\n\n
+ */
+void XMC_UART_CH_DMA_RX_Flush(XMC_UART_CH_DMA_RX_t *const handle);
+
+/**
+ * @param handle UART DMA receive state
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Handles the message end event.\n\n
+ * The protocol status flags are cleared and the received data is passed to the handler. Call the function from
+ * the interrupt handler of the message service request.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_UART_CH_DMA_RX_Flush()\n\n\n
+ */
+void XMC_UART_CH_DMA_RX_IRQHandler(XMC_UART_CH_DMA_RX_t *const handle);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
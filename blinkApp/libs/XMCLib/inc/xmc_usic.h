@@ -67,6 +67,11 @@
  *     - Added API for enabling the transfer trigger unit to set bit TCSR.TE if the trigger signal DX2T becomes active. Feature used for RS-232
  *       Clear to Send (CTS) signal: XMC_USIC_CH_EnableTBUFDataValidTrigger() and XMC_USIC_CH_DisableTBUFDataValidTrigger().
  *
+ * 2026-10-17:
+ *     - Added bus manager sharing a channel between devices with precomputed register images: XMC_USIC_CH_BUS_Init(),
+ *       XMC_USIC_CH_BUS_CaptureDevice(), XMC_USIC_CH_BUS_SetDeviceBaudrate(), XMC_USIC_CH_BUS_Acquire(),
+ *       XMC_USIC_CH_BUS_Request() and XMC_USIC_CH_BUS_Release()
+ *
  * @endcond
  *
  */
@@ -105,6 +110,7 @@
  * -# Allows reading of received data in FIFO using XMC_USIC_CH_RXFIFO_GetData()
  * -# Allows configuration of baudrate using XMC_USIC_CH_SetBaudrate()
  * -# Provides API to trigger interrupts using XMC_USIC_CH_TriggerServiceRequest()
+ * -# Allows sharing a channel between devices and protocols with precomputed register images using XMC_USIC_CH_BUS_Acquire()
  * @{
  */
 
@@ -140,6 +146,44 @@
 #define USIC_CH_DXCR_INSW_Msk  USIC_CH_DX0CR_INSW_Msk   /**< Common mask for INSW bitfield mask in DXnCR register */
 #define USIC_CH_DXCR_INSW_pos  USIC_CH_DX0CR_INSW_Pos   /**< Common mask for INSW bitfield position in DXnCR register */
 
+#define XMC_USIC_CH_BRG_STEP_MAX (1023UL) /**< Largest fractional divider step FDR.STEP */
+#define XMC_USIC_CH_BRG_PDIV_MAX (1024UL) /**< Largest prescaler divide factor BRG.PDIV + 1 */
+
+/* Largest prescaler factor keeping STEP within range, before clamping */
+#define XMC_USIC_CH_BRG_PDIV_RAW(fperiph, rate, oversampling) \
+  ((XMC_USIC_CH_BRG_STEP_MAX * (uint64_t)(fperiph)) / (1024ULL * (uint64_t)(rate) * (uint64_t)(oversampling)))
+
+/**
+ * Prescaler divide factor (BRG.PDIV + 1) for a fixed baudrate. Reduces to a constant when all arguments are constants.
+ */
+#define XMC_USIC_CH_BRG_PDIV(fperiph, rate, oversampling) \
+  ((uint16_t)((XMC_USIC_CH_BRG_PDIV_RAW((fperiph), (rate), (oversampling)) > XMC_USIC_CH_BRG_PDIV_MAX) ? XMC_USIC_CH_BRG_PDIV_MAX : \
+              ((XMC_USIC_CH_BRG_PDIV_RAW((fperiph), (rate), (oversampling)) == 0ULL) ? 1ULL : \
+               XMC_USIC_CH_BRG_PDIV_RAW((fperiph), (rate), (oversampling)))))
+
+/* Rounded fractional divider step for the prescaler factor above, before clamping */
+#define XMC_USIC_CH_BRG_STEP_RAW(fperiph, rate, oversampling) \
+  (((1024ULL * (uint64_t)(rate) * (uint64_t)(oversampling) * XMC_USIC_CH_BRG_PDIV((fperiph), (rate), (oversampling))) + \
+    ((uint64_t)(fperiph) / 2ULL)) / (uint64_t)(fperiph))
+
+/**
+ * Fractional divider step (FDR.STEP) for a fixed baudrate. Reduces to a constant when all arguments are constants.
+ */
+#define XMC_USIC_CH_BRG_STEP(fperiph, rate, oversampling) \
+  ((uint16_t)((XMC_USIC_CH_BRG_STEP_RAW((fperiph), (rate), (oversampling)) > XMC_USIC_CH_BRG_STEP_MAX) ? XMC_USIC_CH_BRG_STEP_MAX : \
+              ((XMC_USIC_CH_BRG_STEP_RAW((fperiph), (rate), (oversampling)) == 0ULL) ? 1ULL : \
+               XMC_USIC_CH_BRG_STEP_RAW((fperiph), (rate), (oversampling)))))
+
+/**
+ * Static initializer of @ref XMC_USIC_CH_BRG_CONFIG_t for a baudrate known at build time. The divider pair is chosen
+ * with the largest prescaler factor that keeps the step in range, so the rounding error stays below 0.1% whenever the
+ * rate is reachable. Use XMC_USIC_CH_CalculateBaudrate() at runtime for the best pair.
+ */
+#define XMC_USIC_CH_BRG_CONFIG_INIT(fperiph, rate, oversampling) \
+  { XMC_USIC_CH_BRG_STEP((fperiph), (rate), (oversampling)), \
+    XMC_USIC_CH_BRG_PDIV((fperiph), (rate), (oversampling)), \
+    (uint16_t)(oversampling) }
+
 #if UC_FAMILY == XMC1
  #include "xmc1_usic_map.h"
 #endif
@@ -437,6 +481,17 @@ typedef enum XMC_USIC_CH_BRG_SHIFT_CLOCK_OUTPUT
  * DATA STRUCTURES
  *******************************************************************************/
 
+/**
+ * Baudrate generator divider settings, as computed by XMC_USIC_CH_CalculateBaudrate() or XMC_USIC_CH_BRG_CONFIG_INIT().
+ * The resulting baudrate is fperiph * (step / 1024) / (pdiv * oversampling).
+ */
+typedef struct XMC_USIC_CH_BRG_CONFIG
+{
+  uint16_t step;          /**< Fractional divider step FDR.STEP. \b Range: 1 to 1023 */
+  uint16_t pdiv;          /**< Prescaler divide factor BRG.PDIV + 1. \b Range: 1 to 1024 */
+  uint16_t oversampling;  /**< Time quanta per symbol BRG.DCTQ + 1. \b Range: 1 to 32 */
+} XMC_USIC_CH_BRG_CONFIG_t;
+
 /*Anonymous structure/union guard start*/
 #if defined(__CC_ARM)
   #pragma push
@@ -510,6 +565,48 @@ typedef struct XMC_USIC_CH
   __O  uint32_t  IN[32];		/**< Transmit FIFO input register*/
 } XMC_USIC_CH_t;
 
+/**
+ * Register image of a device attached to a shared channel, see XMC_USIC_CH_BUS_CaptureDevice()
+ */
+typedef struct XMC_USIC_CH_BUS_DEVICE
+{
+  uint32_t fdr;                         /**< Fractional divider register */
+  uint32_t brg;                         /**< Baud rate generator register */
+  uint32_t dxcr[3];                     /**< Input control registers DX0 to DX2 */
+  uint32_t sctr;                        /**< Shift control register */
+  uint32_t tcsr;                        /**< Transmit control/status register */
+  uint32_t pcr;                         /**< Protocol configuration register, including the slave select outputs */
+  uint32_t ccr;                         /**< Channel control register, including the operating mode */
+} XMC_USIC_CH_BUS_DEVICE_t;
+
+/**
+ * Bus request handler, called once the bus has been granted and switched to the requested device
+ */
+typedef void (*XMC_USIC_CH_BUS_HANDLER_t)(void *context);
+
+/**
+ * Deferred bus request, see XMC_USIC_CH_BUS_Request()
+ */
+typedef struct XMC_USIC_CH_BUS_REQUEST
+{
+  struct XMC_USIC_CH_BUS_REQUEST *next;       /**< Used by the bus manager */
+  const XMC_USIC_CH_BUS_DEVICE_t *device;     /**< Device to switch to */
+  XMC_USIC_CH_BUS_HANDLER_t handler;          /**< Handler called with the bus granted */
+  void *context;                              /**< User context passed to \a handler */
+  uint8_t priority;                           /**< Higher values are granted first, e.g. for interrupt level users */
+} XMC_USIC_CH_BUS_REQUEST_t;
+
+/**
+ * Shared channel state
+ */
+typedef struct XMC_USIC_CH_BUS
+{
+  XMC_USIC_CH_t *channel;                     /**< USIC channel */
+  const XMC_USIC_CH_BUS_DEVICE_t *device;     /**< Device the channel is currently configured for */
+  XMC_USIC_CH_BUS_REQUEST_t *pending;         /**< Pending requests, highest priority first */
+  volatile bool locked;                       /**< Bus is owned by a user */
+} XMC_USIC_CH_BUS_t;
+
 
 /*Anonymous structure/union guard end*/
 #if defined(__CC_ARM)
@@ -630,13 +727,71 @@ void XMC_USIC_CH_Disable(XMC_USIC_CH_t *const channel);
  * Configures the baudrate of the USIC channel. \n\n
  * Baudrate is configured by considering the peripheral frequency and the desired baudrate.
  * Optimum values of FDR->STEP and BRG->PDIV are calulated and used for generating the desired
- * baudrate.
+ * baudrate. The peripheral clock frequency is read on every call; use XMC_USIC_CH_CalculateBaudrate() and
+ * XMC_USIC_CH_SetBaudrateConfig() to compute the settings once.
  *
  * \par<b>Related APIs:</b><BR>
- * XMC_USIC_CH_SetStartTransmisionMode(), XMC_USIC_CH_SetInputSource() \n\n\n
+ * XMC_USIC_CH_SetStartTransmisionMode(), XMC_USIC_CH_SetInputSource(), XMC_USIC_CH_CalculateBaudrate() \n\n\n
  */
 XMC_USIC_CH_STATUS_t XMC_USIC_CH_SetBaudrate(XMC_USIC_CH_t *const channel, uint32_t rate, uint32_t oversampling);
 
+/**
+ * @param  peripheral_clock Frequency of the USIC kernel clock in Hz, e.g. as returned by XMC_SCU_CLOCK_GetPeripheralClockFrequency()
+ * @param  rate Desired baudrate in Hz. \b Range: greater than 0.
+ * @param  oversampling Required oversampling. \b Range: 1 to 32.
+ * @param  config Pointer to the divider settings to be filled in.
+ * @return Status of the calculation.\n
+ * 			\b Range: @ref XMC_USIC_CH_STATUS_OK if the settings were computed,
+ * 					  @ref XMC_USIC_CH_STATUS_ERROR if the clock, baudrate or oversampling is invalid.
+ *
+ * \par<b>Description</b><br>
+ * Computes the divider settings for a baudrate without touching the hardware. \n\n
+ * The pair FDR.STEP / (BRG.PDIV + 1) closest to 1024 * \a rate * \a oversampling / \a peripheral_clock is found from
+ * the continued fraction expansion of that ratio, which takes a few steps instead of a search over all STEP values.
+ * The settings can be computed once for a fixed clock and applied with XMC_USIC_CH_SetBaudrateConfig() on every
+ * rate change. If the rate cannot be reached exactly, the nearest one is selected; see XMC_USIC_CH_GetBaudrateError().
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_USIC_CH_SetBaudrateConfig(), XMC_USIC_CH_GetBaudrateError(), XMC_USIC_CH_SetBaudrate() \n\n\n
+ */
+XMC_USIC_CH_STATUS_t XMC_USIC_CH_CalculateBaudrate(uint32_t peripheral_clock,
+                                                   uint32_t rate,
+                                                   uint32_t oversampling,
+                                                   XMC_USIC_CH_BRG_CONFIG_t *const config);
+
+/**
+ * @param  peripheral_clock Frequency of the USIC kernel clock in Hz used to compute \a config
+ * @param  rate Desired baudrate in Hz. \b Range: greater than 0.
+ * @param  config Pointer to the divider settings.
+ * @return Deviation of the generated baudrate from \a rate in parts per million. Positive if the generated
+ * 		   baudrate is higher than \a rate.
+ *
+ * \par<b>Description</b><br>
+ * Reports the baudrate error of a set of divider settings. \n\n
+ * Useful to check a configuration against the tolerance of the protocol, e.g. before changing the clock system.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_USIC_CH_CalculateBaudrate() \n\n\n
+ */
+int32_t XMC_USIC_CH_GetBaudrateError(uint32_t peripheral_clock,
+                                     uint32_t rate,
+                                     const XMC_USIC_CH_BRG_CONFIG_t *const config);
+
+/**
+ * @param  channel Pointer to USIC channel handler of type @ref XMC_USIC_CH_t \n
+ * 				   \b Range: @ref XMC_USIC0_CH0, @ref XMC_USIC0_CH1 to @ref XMC_USIC2_CH1 based on device support.
+ * @param  config Pointer to the divider settings.
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Programs precomputed divider settings into FDR and BRG registers. \n\n
+ * The fractional divider mode is selected. No arithmetic is performed, making it suitable for frequent rate changes.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_USIC_CH_CalculateBaudrate(), XMC_USIC_CH_SetBaudrate() \n\n\n
+ */
+void XMC_USIC_CH_SetBaudrateConfig(XMC_USIC_CH_t *const channel, const XMC_USIC_CH_BRG_CONFIG_t *const config);
+
 /**
  * @param  channel Pointer to USIC channel handler of type @ref XMC_USIC_CH_t \n
  * 				   \b Range: @ref XMC_USIC0_CH0, @ref XMC_USIC0_CH1 to @ref XMC_USIC2_CH1 based on device support.
@@ -1314,6 +1469,25 @@ __STATIC_INLINE void XMC_USIC_CH_SetPassiveDataLevel(XMC_USIC_CH_t *const channe
 }
 
 /* TX FIFO APIs */
+/**
+ * @param size Size of the FIFO. \n
+ * 		\b Range: @ref XMC_USIC_CH_FIFO_DISABLED, @ref XMC_USIC_CH_FIFO_SIZE_2WORDS.. @ref XMC_USIC_CH_FIFO_SIZE_64WORDS
+ * @param data_pointer Start position inside the FIFO buffer.
+ * @param limit Threshold of the FIFO filling level to be considered for generating events.
+ * @return bool true if the FIFO configuration is valid.
+ *
+ * \par<b>Description</b><br>
+ * Checks a transmit or receive FIFO configuration before it is passed to XMC_USIC_CH_TXFIFO_Configure() or
+ * XMC_USIC_CH_RXFIFO_Configure(). The FIFO must be enabled, must fit into the common FIFO buffer of 64 words from
+ * \a data_pointer on, and \a limit must be below the FIFO size.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_USIC_CH_TXFIFO_Configure(), XMC_USIC_CH_RXFIFO_Configure() \n\n\n
+ */
+bool XMC_USIC_CH_IsFifoConfigValid(const XMC_USIC_CH_FIFO_SIZE_t size,
+                                   const uint32_t data_pointer,
+                                   const uint32_t limit);
+
 /**
  * @param channel Pointer to USIC channel handler of type @ref XMC_USIC_CH_t \n
  * 				   \b Range: @ref XMC_USIC0_CH0, @ref XMC_USIC0_CH1 to @ref XMC_USIC2_CH1 based on device support.
@@ -1975,6 +2149,120 @@ __STATIC_INLINE void XMC_USIC_CH_SetMode(XMC_USIC_CH_t *const channel, const XMC
 {
   channel->CCR = (uint32_t)(channel->CCR & (~(USIC_CH_CCR_MODE_Msk))) | (uint32_t)mode;
 }
+
+/**
+ * @param  bus Shared channel state
+ * @param  channel Pointer to USIC channel handler of type @ref XMC_USIC_CH_t \n
+ * 				   \b Range: @ref XMC_USIC0_CH0, @ref XMC_USIC0_CH1 to @ref XMC_USIC2_CH1 based on device support.
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Initializes the bus manager of a channel shared between several devices.\n\n
+ * The bus is unlocked and no device is selected, so the first XMC_USIC_CH_BUS_Acquire() programs the full register
+ * image. The FIFO configuration is common to all devices and is not touched by the bus manager.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_USIC_CH_BUS_CaptureDevice(), XMC_USIC_CH_BUS_Acquire() \n\n\n
+ */
+void XMC_USIC_CH_BUS_Init(XMC_USIC_CH_BUS_t *const bus, XMC_USIC_CH_t *const channel);
+
+/**
+ * @param  channel Pointer to USIC channel handler of type @ref XMC_USIC_CH_t \n
+ * 				   \b Range: @ref XMC_USIC0_CH0, @ref XMC_USIC0_CH1 to @ref XMC_USIC2_CH1 based on device support.
+ * @param  device Register image to be filled in
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Stores the current channel configuration as the register image of a device.\n\n
+ * Configure the channel once per device with the protocol driver, e.g. XMC_SPI_CH_Init(), XMC_SPI_CH_SetBaudrate()
+ * and XMC_SPI_CH_EnableSlaveSelect(), then capture the result. FDR, BRG, DX0CR to DX2CR, SCTR, TCSR, PCR and CCR
+ * are stored, so devices may differ in protocol, baudrate, frame format and slave select. Port pin functions are
+ * not part of the image.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_USIC_CH_BUS_SetDeviceBaudrate(), XMC_USIC_CH_BUS_Acquire() \n\n\n
+ */
+void XMC_USIC_CH_BUS_CaptureDevice(const XMC_USIC_CH_t *const channel, XMC_USIC_CH_BUS_DEVICE_t *const device);
+
+/**
+ * @param  device Register image
+ * @param  config Pointer to the divider settings, e.g. computed by XMC_USIC_CH_CalculateBaudrate()
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Replaces the divider settings of a register image.\n\n
+ * Allows to derive images of devices which only differ in their clock rate from one captured image. Images are
+ * compared by address when switching, so an image must not be changed while its device is selected on the bus.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_USIC_CH_BUS_CaptureDevice(), XMC_USIC_CH_CalculateBaudrate() \n\n\n
+ */
+void XMC_USIC_CH_BUS_SetDeviceBaudrate(XMC_USIC_CH_BUS_DEVICE_t *const device, const XMC_USIC_CH_BRG_CONFIG_t *const config);
+
+/**
+ * @param  bus Shared channel state
+ * @param  device Register image of the device to be accessed
+ * @return Status of the operation.\n
+ * 			\b Range: @ref XMC_USIC_CH_STATUS_OK if the bus is granted,
+ * 					  @ref XMC_USIC_CH_STATUS_BUSY if it is locked or requests are pending.
+ *
+ * \par<b>Description</b><br>
+ * Tries to lock the bus for a device.\n\n
+ * The call never waits. If granted and another device was selected before, the channel is switched by writing the
+ * register image with the channel in idle mode; otherwise no register is written. Pending requests of
+ * XMC_USIC_CH_BUS_Request() are served first, so a thread level user polling this function cannot starve interrupt
+ * level users. The bus must be released with XMC_USIC_CH_BUS_Release() once the transfer has finished.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_USIC_CH_BUS_Request(), XMC_USIC_CH_BUS_Release() \n\n\n
+ */
+XMC_USIC_CH_STATUS_t XMC_USIC_CH_BUS_Acquire(XMC_USIC_CH_BUS_t *const bus, const XMC_USIC_CH_BUS_DEVICE_t *const device);
+
+/**
+ * @param  bus Shared channel state
+ * @param  request Request, must stay valid until its handler has been called
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Requests the bus without waiting.\n\n
+ * If the bus is free, it is locked, switched to the device and the handler is called immediately. Otherwise the
+ * request is queued by priority and granted by XMC_USIC_CH_BUS_Release() in the context of the releasing user.
+ * Suitable for interrupt level users. The handler owns the bus and must release it when done.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_USIC_CH_BUS_Acquire(), XMC_USIC_CH_BUS_Release() \n\n\n
+ */
+void XMC_USIC_CH_BUS_Request(XMC_USIC_CH_BUS_t *const bus, XMC_USIC_CH_BUS_REQUEST_t *const request);
+
+/**
+ * @param  bus Shared channel state
+ * @return None
+ *
+ * \par<b>Description</b><br>
+ * Releases the bus.\n\n
+ * If requests are pending, the bus is handed over to the highest priority one and its handler is called before
+ * returning. Call it only when the transfer of the current device has completed.
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_USIC_CH_BUS_Acquire(), XMC_USIC_CH_BUS_Request() \n\n\n
+ */
+void XMC_USIC_CH_BUS_Release(XMC_USIC_CH_BUS_t *const bus);
+
+/**
+ * @param  bus Shared channel state
+ * @return bool Bus is owned by a user
+ *
+ * \par<b>Description</b><br>
+ * Checks whether the bus is locked.\n\n
+ *
+ * \par<b>Related APIs:</b><BR>
+ * XMC_USIC_CH_BUS_Acquire() \n\n\n
+ */
+__STATIC_INLINE bool XMC_USIC_CH_BUS_IsLocked(const XMC_USIC_CH_BUS_t *const bus)
+{
+  return bus->locked;
+}
+
 #ifdef __cplusplus
 }
 #endif
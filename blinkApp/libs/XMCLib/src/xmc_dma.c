@@ -37,6 +37,15 @@
  * Change History
  * --------------
  *
+ * 2026-10-17:
+ *     - Add linked list chain builder and validation, XMC_DMA_CH_InitLinkedList() <br>
+ *     - XMC_DMA_IRQHandler() services all pending events and channels in one call <br>
+ *     - Add event handlers with user context, channel event and interrupt counters <br>
+ *     - Add queued DMA memory copy and fill engine with CPU fallback for small requests <br>
+ *     - Add continuous DMA streams over looping linked lists or auto-reload <br>
+ *     - Add runtime channel and DLR line allocator with channel mapping report <br>
+ *     - Add optional DWT based channel instrumentation (XMC_DMA_INSTRUMENTATION_ENABLE) <br>
+ *
  * 2015-02-20:
  *     - Initial <br>
  *
@@ -80,18 +89,150 @@
 #define GPDMA1_CH_CFGH_PER_Msk (0x3U)
 #define GPDMA_CH_CFGH_PER_BITSIZE (4U)
 #define GPDMA_CH_CTLL_INT_EN_Msk GPDMA0_CH_CTLL_INT_EN_Msk
+#define GPDMA_CH_CTLL_LLP_EN_Msk (GPDMA0_CH_CTLL_LLP_SRC_EN_Msk | GPDMA0_CH_CTLL_LLP_DST_EN_Msk)
+#define DMA_LLI_ALIGN_MSK (0x3UL)
+
+#define DMA_CH_STATUS_MSK (0xffUL)
+#define DMA_MEMCPY_FILL_PATTERN (0x01010101UL)
+#define DMA_MEMCPY_WORD_SIZE (4U)     /* Bytes of the widest memory copy transfer */
+#define DMA_CH_FIFO_SIZE_LLI (32U)
+#define DMA_CH_FIFO_SIZE (8U)
+#define DMA_LATENCY_BIN_SHIFT (7U)
+#define DMA_LLI_MAX_WALK (256U)       /* Linked list items accounted per event at most */
+
+/*******************************************************************************
+ * DATA STRUCTURES
+ *******************************************************************************/
+
+/* Event handler and event counters of a DMA channel */
+typedef struct XMC_DMA_CH_HANDLER
+{
+  XMC_DMA_CH_EVENT_HANDLER_t event_handler;
+  XMC_DMA_CH_EVENT_CONTEXT_HANDLER_t context_handler;
+  void *context;
+  uint32_t event_count[DMA_EVENT_MAX];
+  const char *owner;
+  uint32_t bytes_per_second;
+  XMC_DMA_CH_PRIORITY_t priority;
+  uint8_t src_line;
+  uint8_t dst_line;
+  bool allocated;
+#if defined(XMC_DMA_INSTRUMENTATION_ENABLE)
+  XMC_DMA_CH_STATISTICS_t stats;
+  const XMC_DMA_LLI_t *lli;
+  uint32_t block_bytes;
+  uint32_t enable_timestamp;
+  bool timing;
+#endif
+} XMC_DMA_CH_HANDLER_t;
+
+/* Channel table, interrupt count and reserved DLR lines of a DMA module */
+typedef struct XMC_DMA_HANDLERS
+{
+  XMC_DMA_CH_HANDLER_t *channels;
+  uint32_t interrupt_count;
+  uint32_t reserved_lines;
+  uint8_t num_channels;
+#if defined(XMC_DMA_INSTRUMENTATION_ENABLE)
+  uint32_t clear_timestamp;
+#endif
+} XMC_DMA_HANDLERS_t;
 
 /*******************************************************************************
  * LOCAL DATA
  *******************************************************************************/
 
 #if defined (GPDMA0)
-XMC_DMA_CH_EVENT_HANDLER_t dma0_event_handlers[XMC_DMA0_NUM_CHANNELS];
+static XMC_DMA_CH_HANDLER_t dma0_channel_handlers[XMC_DMA0_NUM_CHANNELS];
+static XMC_DMA_HANDLERS_t dma0_handlers = {dma0_channel_handlers, 0U, 0U, (uint8_t)XMC_DMA0_NUM_CHANNELS};
 #endif
 
 #if defined (GPDMA1)
-XMC_DMA_CH_EVENT_HANDLER_t dma1_event_handlers[XMC_DMA1_NUM_CHANNELS];
+static XMC_DMA_CH_HANDLER_t dma1_channel_handlers[XMC_DMA1_NUM_CHANNELS];
+static XMC_DMA_HANDLERS_t dma1_handlers = {dma1_channel_handlers, 0U, 0U, (uint8_t)XMC_DMA1_NUM_CHANNELS};
+#endif
+
+/* Events cleared along with each event type, indexed by event bit position */
+static const uint32_t dma_event_clear_masks[DMA_EVENT_MAX] =
+{
+  (uint32_t)XMC_DMA_CH_EVENT_TRANSFER_COMPLETE |
+  (uint32_t)XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE |
+  (uint32_t)XMC_DMA_CH_EVENT_SRC_TRANSACTION_COMPLETE |
+  (uint32_t)XMC_DMA_CH_EVENT_DST_TRANSACTION_COMPLETE,
+  (uint32_t)XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE |
+  (uint32_t)XMC_DMA_CH_EVENT_SRC_TRANSACTION_COMPLETE |
+  (uint32_t)XMC_DMA_CH_EVENT_DST_TRANSACTION_COMPLETE,
+  (uint32_t)XMC_DMA_CH_EVENT_SRC_TRANSACTION_COMPLETE,
+  (uint32_t)XMC_DMA_CH_EVENT_DST_TRANSACTION_COMPLETE,
+  (uint32_t)XMC_DMA_CH_EVENT_ERROR
+};
+
+/* Event service order of the IRQ handler, indexed by service position */
+static const uint8_t dma_event_order[DMA_EVENT_MAX] = {4U, 0U, 1U, 2U, 3U};
+
+/*******************************************************************************
+ * LOCAL ROUTINES
+ *******************************************************************************/
+
+/* Get the handler table of a DMA module */
+static XMC_DMA_HANDLERS_t *XMC_DMA_lGetHandlers(const XMC_DMA_t *const dma)
+{
+  XMC_DMA_HANDLERS_t *handlers;
+
+#if defined(GPDMA1)
+  if (dma == XMC_DMA0)
+  {
+#endif
+    handlers = &dma0_handlers;
+#if defined(GPDMA1)
+  }
+  else
+  {
+    handlers = &dma1_handlers;
+  }
+#endif
+
+  return handlers;
+}
+
+/* DLR line of a peripheral request */
+static uint8_t XMC_DMA_lGetRequestLine(const XMC_DMA_t *const dma, const uint8_t request)
+{
+  uint8_t line;
+
+  if (request == XMC_DMA_NO_PERIPHERAL_REQUEST)
+  {
+    line = XMC_DMA_NO_LINE;
+  }
+  else
+  {
+#if defined(GPDMA1)
+    if (dma == XMC_DMA0)
+    {
+#endif
+      line = request & GPDMA0_CH_CFGH_PER_Msk;
+#if defined(GPDMA1)
+    }
+    else
+    {
+      line = request & GPDMA1_CH_CFGH_PER_Msk;
+    }
 #endif
+  }
+
+  return line;
+}
+
+/* Check if a DLR line may be used by a channel, i.e. it is not reserved for another channel */
+static bool XMC_DMA_lIsLineAvailable(const XMC_DMA_t *const dma, const uint8_t channel, const uint8_t line)
+{
+  const XMC_DMA_HANDLERS_t *const handlers = XMC_DMA_lGetHandlers(dma);
+  const XMC_DMA_CH_HANDLER_t *const handler = &handlers->channels[channel];
+
+  return ((line == XMC_DMA_NO_LINE) ||
+          ((handlers->reserved_lines & ((uint32_t)1U << line)) == 0U) ||
+          ((handler->allocated == true) && ((handler->src_line == line) || (handler->dst_line == line))));
+}
  
 /*******************************************************************************
  * API IMPLEMENTATION
@@ -299,12 +440,32 @@ bool XMC_DMA_CH_IsEnabled(XMC_DMA_t *const dma, const uint8_t channel)
 XMC_DMA_CH_STATUS_t XMC_DMA_CH_Init(XMC_DMA_t *const dma, const uint8_t channel, const XMC_DMA_CH_CONFIG_t *const config)
 {
   XMC_DMA_CH_STATUS_t status;
-  uint8_t line;
+  uint8_t src_line;
+  uint8_t dst_line;
   uint8_t peripheral;
 
+  /* DLR lines driven by hardware handshaking */
+  src_line = XMC_DMA_NO_LINE;
+  if ((config->src_handshaking == XMC_DMA_CH_SRC_HANDSHAKING_HARDWARE) &&
+      ((config->transfer_flow == (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_P2M_DMA) ||
+       (config->transfer_flow == (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_P2P_DMA)))
+  {
+    src_line = XMC_DMA_lGetRequestLine(dma, config->src_peripheral_request);
+  }
+
+  dst_line = XMC_DMA_NO_LINE;
+  if ((config->dst_handshaking == XMC_DMA_CH_DST_HANDSHAKING_HARDWARE) &&
+      ((config->transfer_flow == (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_M2P_DMA) ||
+       (config->transfer_flow == (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_P2P_DMA)))
+  {
+    dst_line = XMC_DMA_lGetRequestLine(dma, config->dst_peripheral_request);
+  }
+
   if (XMC_DMA_IsEnabled(dma) == true)
   {
-    if (XMC_DMA_CH_IsEnabled(dma, channel) == false)
+    if ((XMC_DMA_CH_IsEnabled(dma, channel) == false) &&
+        (XMC_DMA_lIsLineAvailable(dma, channel, src_line) == true) &&
+        (XMC_DMA_lIsLineAvailable(dma, channel, dst_line) == true))
     {
       dma->CH[channel].SAR = config->src_addr;
       dma->CH[channel].DAR = config->dst_addr;
@@ -323,56 +484,23 @@ XMC_DMA_CH_STATUS_t XMC_DMA_CH_Init(XMC_DMA_t *const dma, const uint8_t channel,
         dma->CH[channel].DSR = config->dst_scatter_control;
       }
 
-      if (config->dst_handshaking == XMC_DMA_CH_DST_HANDSHAKING_HARDWARE)
+      if (dst_line != XMC_DMA_NO_LINE)
       {
         /* Hardware handshaking interface configuration */
-        if ((config->transfer_flow == (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_M2P_DMA) ||
-            (config->transfer_flow == (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_P2P_DMA))
-        {
-#if defined(GPDMA1)
-          if (dma == XMC_DMA0)
-          {
-#endif
-            line = config->dst_peripheral_request & GPDMA0_CH_CFGH_PER_Msk;
-#if defined(GPDMA1)
-          }
-          else
-          {
-            line = config->dst_peripheral_request & GPDMA1_CH_CFGH_PER_Msk;
-          }
-#endif
-          peripheral = config->dst_peripheral_request >> GPDMA_CH_CFGH_PER_BITSIZE;
+        peripheral = config->dst_peripheral_request >> GPDMA_CH_CFGH_PER_BITSIZE;
 
-          dma->CH[channel].CFGH |= (uint32_t)((uint32_t)line << GPDMA0_CH_CFGH_DEST_PER_Pos);
-          XMC_DMA_EnableRequestLine(dma, line, peripheral);
-          dma->CH[channel].CFGL &= (uint32_t)~GPDMA0_CH_CFGL_HS_SEL_DST_Msk;
-        }
+        dma->CH[channel].CFGH |= (uint32_t)((uint32_t)dst_line << GPDMA0_CH_CFGH_DEST_PER_Pos);
+        XMC_DMA_EnableRequestLine(dma, dst_line, peripheral);
+        dma->CH[channel].CFGL &= (uint32_t)~GPDMA0_CH_CFGL_HS_SEL_DST_Msk;
       }
 
-
-      if (config->src_handshaking == XMC_DMA_CH_SRC_HANDSHAKING_HARDWARE)
+      if (src_line != XMC_DMA_NO_LINE)
       {
-        if ((config->transfer_flow == (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_P2M_DMA) ||
-            (config->transfer_flow == (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_P2P_DMA))
-        {
-#if defined(GPDMA1)
-          if (dma == XMC_DMA0)
-          {
-#endif
-            line = config->src_peripheral_request & GPDMA0_CH_CFGH_PER_Msk;
-#if defined(GPDMA1)
-          }
-          else
-          {
-            line = config->src_peripheral_request & GPDMA1_CH_CFGH_PER_Msk;
-          }
-#endif
-          peripheral = config->src_peripheral_request >> GPDMA_CH_CFGH_PER_BITSIZE;
+        peripheral = config->src_peripheral_request >> GPDMA_CH_CFGH_PER_BITSIZE;
 
-          dma->CH[channel].CFGH |= (uint32_t)((uint32_t)line << GPDMA0_CH_CFGH_SRC_PER_Pos);
-          XMC_DMA_EnableRequestLine(dma, line, peripheral);
-          dma->CH[channel].CFGL &= (uint32_t)~GPDMA0_CH_CFGL_HS_SEL_SRC_Msk;
-        }
+        dma->CH[channel].CFGH |= (uint32_t)((uint32_t)src_line << GPDMA0_CH_CFGH_SRC_PER_Pos);
+        XMC_DMA_EnableRequestLine(dma, src_line, peripheral);
+        dma->CH[channel].CFGL &= (uint32_t)~GPDMA0_CH_CFGL_HS_SEL_SRC_Msk;
       }
       
       XMC_DMA_CH_ClearEventStatus(dma, channel, (uint32_t)((uint32_t)XMC_DMA_CH_EVENT_TRANSFER_COMPLETE |
@@ -431,6 +559,7 @@ XMC_DMA_CH_STATUS_t XMC_DMA_CH_Init(XMC_DMA_t *const dma, const uint8_t channel,
     }
     else
     {
+      /* Channel running, or a DLR line reserved for another channel by XMC_DMA_AllocateChannel() */
       status = XMC_DMA_CH_STATUS_BUSY;
     }
   }
@@ -442,6 +571,138 @@ XMC_DMA_CH_STATUS_t XMC_DMA_CH_Init(XMC_DMA_t *const dma, const uint8_t channel,
   return status;
 }
 
+/* Check a single linked list item */
+static bool XMC_DMA_lIsValidLinkedListItem(const XMC_DMA_LLI_t *const item)
+{
+  uint32_t src_align;
+  uint32_t dst_align;
+  bool linked;
+  bool valid;
+
+  valid = (((uint32_t)item & DMA_LLI_ALIGN_MSK) == 0U) &&
+          (item->block_size > 0U) &&
+          (item->block_size <= XMC_DMA_LLI_MAX_BLOCK_SIZE) &&
+          (item->src_transfer_width <= (uint32_t)XMC_DMA_CH_TRANSFER_WIDTH_32) &&
+          (item->dst_transfer_width <= (uint32_t)XMC_DMA_CH_TRANSFER_WIDTH_32);
+
+  if (valid == true)
+  {
+    src_align = ((uint32_t)1U << item->src_transfer_width) - 1U;
+    dst_align = ((uint32_t)1U << item->dst_transfer_width) - 1U;
+    linked = ((item->control & (uint32_t)GPDMA_CH_CTLL_LLP_EN_Msk) == (uint32_t)GPDMA_CH_CTLL_LLP_EN_Msk);
+
+    valid = ((item->src_addr & src_align) == 0U) &&
+            ((item->dst_addr & dst_align) == 0U) &&
+            (linked == (item->llp != NULL));
+  }
+
+  return valid;
+}
+
+/* Build a linked list chain */
+XMC_DMA_CH_STATUS_t XMC_DMA_LLI_BuildChain(XMC_DMA_LLI_t *const chain,
+                                           const XMC_DMA_LLI_BLOCK_t *const blocks,
+                                           const uint32_t count,
+                                           const uint32_t control,
+                                           const bool loop)
+{
+  XMC_DMA_CH_STATUS_t status;
+  uint32_t idx;
+
+  if ((chain == NULL) || (blocks == NULL) || (count == 0U))
+  {
+    status = XMC_DMA_CH_STATUS_ERROR;
+  }
+  else
+  {
+    for (idx = 0U; idx < count; ++idx)
+    {
+      chain[idx].src_addr = blocks[idx].src_addr;
+      chain[idx].dst_addr = blocks[idx].dst_addr;
+      chain[idx].control = (control & (uint32_t)~GPDMA_CH_CTLL_LLP_EN_Msk) | (uint32_t)GPDMA_CH_CTLL_LLP_EN_Msk;
+      chain[idx].block_size = blocks[idx].block_size;
+      chain[idx].src_status = 0U;
+      chain[idx].dst_status = 0U;
+      chain[idx].llp = &chain[idx + 1U];
+    }
+
+    if (loop == true)
+    {
+      chain[count - 1U].llp = chain;
+    }
+    else
+    {
+      XMC_DMA_LLI_EndChain(&chain[count - 1U]);
+    }
+
+    status = XMC_DMA_LLI_ValidateChain(chain, count);
+  }
+
+  return status;
+}
+
+/* Validate a linked list chain */
+XMC_DMA_CH_STATUS_t XMC_DMA_LLI_ValidateChain(const XMC_DMA_LLI_t *const head, const uint32_t max_items)
+{
+  XMC_DMA_CH_STATUS_t status;
+  const XMC_DMA_LLI_t *item;
+  uint32_t items;
+
+  status = XMC_DMA_CH_STATUS_ERROR;
+  item = head;
+  items = 0U;
+
+  while ((item != NULL) && (items < max_items) && (XMC_DMA_lIsValidLinkedListItem(item) == true))
+  {
+    ++items;
+    item = item->llp;
+
+    if ((item == NULL) || (item == head))
+    {
+      /* End of chain or loop back to the first item */
+      status = XMC_DMA_CH_STATUS_OK;
+      break;
+    }
+  }
+
+  return status;
+}
+
+/* End a linked list chain after an item */
+void XMC_DMA_LLI_EndChain(XMC_DMA_LLI_t *const item)
+{
+  item->control &= (uint32_t)~GPDMA_CH_CTLL_LLP_EN_Msk;
+  item->llp = NULL;
+}
+
+/* Initialize DMA channel for a linked list transfer */
+XMC_DMA_CH_STATUS_t XMC_DMA_CH_InitLinkedList(XMC_DMA_t *const dma,
+                                              const uint8_t channel,
+                                              const XMC_DMA_CH_CONFIG_t *const config,
+                                              XMC_DMA_LLI_t *const chain)
+{
+  XMC_DMA_CH_CONFIG_t ch_config;
+  XMC_DMA_CH_STATUS_t status;
+
+  if ((dma != XMC_DMA0) || (channel >= (uint8_t)XMC_DMA_LLI_NUM_CHANNELS) || (chain == NULL))
+  {
+    status = XMC_DMA_CH_STATUS_ERROR;
+  }
+  else
+  {
+    ch_config = *config;
+    ch_config.src_addr = chain->src_addr;
+    ch_config.dst_addr = chain->dst_addr;
+    ch_config.block_size = (uint16_t)chain->block_size;
+    ch_config.linked_list_pointer = chain;
+    ch_config.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_MULTI_BLOCK_SRCADR_LINKED_DSTADR_LINKED;
+
+    status = XMC_DMA_CH_Init(dma, channel, &ch_config);
+  }
+
+  return status;
+}
+
 /* Suspend DMA channel transfer */
 void XMC_DMA_CH_Suspend(XMC_DMA_t *const dma, const uint8_t channel)
 {
@@ -609,18 +870,59 @@ void XMC_DMA_CH_RequestLastMultiblockTransfer(XMC_DMA_t *const dma, const uint8_
 /* Set event handler */
 void XMC_DMA_CH_SetEventHandler(XMC_DMA_t *const dma, const uint8_t channel, XMC_DMA_CH_EVENT_HANDLER_t event_handler)
 {
-#if defined(GPDMA1)
-  if (dma == XMC_DMA0)
-  {
-#endif
-    dma0_event_handlers[channel] = event_handler;
-#if defined(GPDMA1)
-  }
-  else
+  XMC_DMA_CH_HANDLER_t *const handler = &XMC_DMA_lGetHandlers(dma)->channels[channel];
+
+  handler->context_handler = NULL;
+  handler->event_handler = event_handler;
+}
+
+/* Set event handler with user context */
+void XMC_DMA_CH_SetEventHandlerContext(XMC_DMA_t *const dma,
+                                       const uint8_t channel,
+                                       XMC_DMA_CH_EVENT_CONTEXT_HANDLER_t event_handler,
+                                       void *const context)
+{
+  XMC_DMA_CH_HANDLER_t *const handler = &XMC_DMA_lGetHandlers(dma)->channels[channel];
+
+  handler->event_handler = NULL;
+  handler->context = context;
+  handler->context_handler = event_handler;
+}
+
+/* Get channel event counters */
+void XMC_DMA_CH_GetEventCounters(XMC_DMA_t *const dma, const uint8_t channel, XMC_DMA_CH_EVENT_COUNTERS_t *const counters)
+{
+  const XMC_DMA_CH_HANDLER_t *const handler = &XMC_DMA_lGetHandlers(dma)->channels[channel];
+
+  counters->transfer_complete = handler->event_count[0];
+  counters->block_transfer_complete = handler->event_count[1];
+  counters->src_transaction_complete = handler->event_count[2];
+  counters->dst_transaction_complete = handler->event_count[3];
+  counters->error = handler->event_count[4];
+}
+
+/* Clear channel event counters */
+void XMC_DMA_CH_ClearEventCounters(XMC_DMA_t *const dma, const uint8_t channel)
+{
+  XMC_DMA_CH_HANDLER_t *const handler = &XMC_DMA_lGetHandlers(dma)->channels[channel];
+  uint32_t event_idx;
+
+  for (event_idx = 0UL; event_idx < DMA_EVENT_MAX; ++event_idx)
   {
-    dma1_event_handlers[channel] = event_handler;
+    handler->event_count[event_idx] = 0U;
   }
-#endif
+}
+
+/* Get number of serviced interrupts */
+uint32_t XMC_DMA_GetInterruptCount(XMC_DMA_t *const dma)
+{
+  return XMC_DMA_lGetHandlers(dma)->interrupt_count;
+}
+
+/* Clear number of serviced interrupts */
+void XMC_DMA_ClearInterruptCount(XMC_DMA_t *const dma)
+{
+  XMC_DMA_lGetHandlers(dma)->interrupt_count = 0U;
 }
 
 void XMC_DMA_CH_ClearSourcePeripheralRequest(XMC_DMA_t *const dma, uint8_t channel)
@@ -639,155 +941,1167 @@ void XMC_DMA_CH_ClearDestinationPeripheralRequest(XMC_DMA_t *const dma, uint8_t
   XMC_DMA_ClearRequestLine(dma, (uint8_t)line);
 }
 
-/* Default DMA IRQ handler */
-void XMC_DMA_IRQHandler(XMC_DMA_t *const dma)
+/* Check if a channel supports linked lists and scatter/gather */
+__STATIC_INLINE bool XMC_DMA_lIsLinkedListChannel(const XMC_DMA_t *const dma, const uint8_t channel)
 {
-  uint32_t event;
-  int32_t channel;
-  uint32_t mask;
-  XMC_DMA_CH_EVENT_HANDLER_t *dma_event_handlers;
-  XMC_DMA_CH_EVENT_HANDLER_t event_handler;
+  return ((dma == XMC_DMA0) && (channel < (uint8_t)XMC_DMA_LLI_NUM_CHANNELS));
+}
 
-#if defined(GPDMA1)
-  if (dma == XMC_DMA0)
+/* FIFO size of a channel in bytes */
+__STATIC_INLINE uint32_t XMC_DMA_lGetFifoSize(const XMC_DMA_t *const dma, const uint8_t channel)
+{
+  return (XMC_DMA_lIsLinkedListChannel(dma, channel) ? DMA_CH_FIFO_SIZE_LLI : DMA_CH_FIFO_SIZE);
+}
+
+/* Check if a channel meets the requirements, without regard to its allocation */
+static bool XMC_DMA_lIsChannelCapable(const XMC_DMA_t *const dma,
+                                      const uint8_t channel,
+                                      const XMC_DMA_CH_REQUIREMENTS_t *const requirements,
+                                      const uint32_t burst_bytes)
+{
+  return ((burst_bytes <= XMC_DMA_lGetFifoSize(dma, channel)) &&
+          ((requirements->linked_list == false) || XMC_DMA_lIsLinkedListChannel(dma, channel)));
+}
+
+/* Allocate a DMA channel */
+XMC_DMA_CH_STATUS_t XMC_DMA_AllocateChannel(const XMC_DMA_CH_REQUIREMENTS_t *const requirements,
+                                            XMC_DMA_t **const dma,
+                                            uint8_t *const channel)
+{
+  XMC_DMA_t *modules[2];
+  XMC_DMA_HANDLERS_t *handlers;
+  XMC_DMA_CH_HANDLER_t *handler;
+  XMC_DMA_CH_STATUS_t status;
+  uint32_t num_modules;
+  uint32_t module_idx;
+  uint32_t burst_bytes;
+  uint32_t line_mask;
+  uint32_t primask;
+  uint32_t idx;
+  uint8_t ch;
+  uint8_t src_line;
+  uint8_t dst_line;
+  bool high_priority;
+  bool capable;
+  bool found;
+
+  XMC_ASSERT("XMC_DMA_AllocateChannel: dma or channel is invalid", (dma != NULL) && (channel != NULL));
+
+  high_priority = ((uint32_t)requirements->priority >= (uint32_t)XMC_DMA_CH_PRIORITY_4);
+
+  if (requirements->dma != NULL)
   {
-#endif
-    dma_event_handlers = dma0_event_handlers;
-#if defined(GPDMA1)
+    modules[0] = requirements->dma;
+    num_modules = 1U;
   }
   else
   {
-    dma_event_handlers = dma1_event_handlers;
-  }
+#if defined(GPDMA1)
+    modules[0] = high_priority ? XMC_DMA0 : XMC_DMA1;
+    modules[1] = high_priority ? XMC_DMA1 : XMC_DMA0;
+    num_modules = 2U;
+#else
+    modules[0] = XMC_DMA0;
+    num_modules = 1U;
 #endif
-  
-  event = XMC_DMA_GetEventStatus(dma);
-  channel = 0;
+  }
 
-  if ((event & (uint32_t)XMC_DMA_CH_EVENT_ERROR) != (uint32_t)0UL)
+  if (((uint32_t)requirements->width > (uint32_t)XMC_DMA_CH_TRANSFER_WIDTH_32) ||
+      ((uint32_t)requirements->burst_length > (uint32_t)XMC_DMA_CH_BURST_LENGTH_8) ||
+      ((requirements->dma == NULL) && ((requirements->src_peripheral_request != XMC_DMA_NO_PERIPHERAL_REQUEST) ||
+                                       (requirements->dst_peripheral_request != XMC_DMA_NO_PERIPHERAL_REQUEST))))
   {
-    event = XMC_DMA_GetChannelsErrorStatus(dma);
-    while (event != 0)
-    {
-      mask = (uint32_t)1U << channel;
-      if ((event & mask) != 0)
-      {
-        event_handler = dma_event_handlers[channel];
-
-        /* Call user callback to handle event */
-        if (event_handler != NULL)
-        {
-          event_handler(XMC_DMA_CH_EVENT_ERROR);
-        }
-
-        XMC_DMA_CH_ClearEventStatus(dma, (uint8_t)channel, (uint32_t)XMC_DMA_CH_EVENT_ERROR);
-        
-        break;
-      }
-      ++channel;
-    }
+    /* Peripheral requests are specific to one module */
+    status = XMC_DMA_CH_STATUS_ERROR;
   }
-  else if ((event & (uint32_t)XMC_DMA_CH_EVENT_TRANSFER_COMPLETE) != (uint32_t)0UL)
+  else
   {
-    event = XMC_DMA_GetChannelsTransferCompleteStatus(dma);
-    while (event != 0)
-    {
-      mask = (uint32_t)1U << channel;
-      if (event & mask)
-      {
-        event_handler = dma_event_handlers[channel];
+    /* Burst of 1, 4 or 8 transfers */
+    burst_bytes = (requirements->burst_length == XMC_DMA_CH_BURST_LENGTH_1) ? 1U : ((uint32_t)2U << (uint32_t)requirements->burst_length);
+    burst_bytes <<= (uint32_t)requirements->width;
 
-        /* Call user callback to handle event */
-        if (event_handler != NULL)
-        {
-          event_handler(XMC_DMA_CH_EVENT_TRANSFER_COMPLETE);
-        }
+    status = XMC_DMA_CH_STATUS_ERROR;
+    found = false;
 
-        XMC_DMA_CH_ClearEventStatus(dma, (uint8_t)channel, (uint32_t)((uint32_t)XMC_DMA_CH_EVENT_TRANSFER_COMPLETE | 
-                                                                      (uint32_t)XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE | 
-                                                                      (uint32_t)XMC_DMA_CH_EVENT_SRC_TRANSACTION_COMPLETE | 
-                                                                      (uint32_t)XMC_DMA_CH_EVENT_DST_TRANSACTION_COMPLETE));
-																	  
-        break;
-      }
-      ++channel;
-    }
-  }
-  else if ((event & (uint32_t)XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE) != (uint32_t)0UL)
-  {
-    event = XMC_DMA_GetChannelsBlockCompleteStatus(dma);
-    while (event != 0)
+    primask = XMC_EnterCriticalSection();
+
+    for (module_idx = 0U; (module_idx < num_modules) && (found == false); ++module_idx)
     {
-      mask = (uint32_t)1U << channel;
-      if (event & mask)
+      handlers = XMC_DMA_lGetHandlers(modules[module_idx]);
+      src_line = XMC_DMA_lGetRequestLine(modules[module_idx], requirements->src_peripheral_request);
+      dst_line = XMC_DMA_lGetRequestLine(modules[module_idx], requirements->dst_peripheral_request);
+
+      line_mask = 0U;
+      if (src_line != XMC_DMA_NO_LINE)
       {
-        event_handler = dma_event_handlers[channel];
+        line_mask |= (uint32_t)1U << src_line;
+      }
+      if (dst_line != XMC_DMA_NO_LINE)
+      {
+        line_mask |= (uint32_t)1U << dst_line;
+      }
 
-        /* Call user callback to handle event */
-        if (event_handler != NULL)
+      /* Source and destination cannot share a handshaking interface */
+      if ((src_line == XMC_DMA_NO_LINE) || (src_line != dst_line))
+      {
+        for (idx = 0U; (idx < handlers->num_channels) && (found == false); ++idx)
         {
-          event_handler(XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE);
-        }
+          /* Fast channels from the bottom, others from the top */
+          ch = high_priority ? (uint8_t)idx : (uint8_t)(handlers->num_channels - 1U - idx);
+          handler = &handlers->channels[ch];
 
-        XMC_DMA_CH_ClearEventStatus(dma, (uint8_t)channel, (uint32_t)((uint32_t)XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE |
-                                                                      (uint32_t)XMC_DMA_CH_EVENT_SRC_TRANSACTION_COMPLETE | 
-                                                                      (uint32_t)XMC_DMA_CH_EVENT_DST_TRANSACTION_COMPLETE));
-        break;
+          capable = XMC_DMA_lIsChannelCapable(modules[module_idx], ch, requirements, burst_bytes);
+          if (capable == true)
+          {
+            if ((handler->allocated == true) || ((handlers->reserved_lines & line_mask) != 0U))
+            {
+              /* Could be met once the channel or line is freed */
+              status = XMC_DMA_CH_STATUS_BUSY;
+            }
+            else
+            {
+              handler->allocated = true;
+              handler->owner = requirements->owner;
+              handler->bytes_per_second = requirements->bytes_per_second;
+              handler->priority = requirements->priority;
+              handler->src_line = src_line;
+              handler->dst_line = dst_line;
+              handlers->reserved_lines |= line_mask;
+
+              *dma = modules[module_idx];
+              *channel = ch;
+              status = XMC_DMA_CH_STATUS_OK;
+              found = true;
+            }
+          }
+        }
       }
-      ++channel;
     }
+
+    XMC_ExitCriticalSection(primask);
   }
-  else if ((event & (uint32_t)XMC_DMA_CH_EVENT_SRC_TRANSACTION_COMPLETE) != (uint32_t)0UL)
+
+  return status;
+}
+
+/* Free an allocated DMA channel */
+void XMC_DMA_FreeChannel(XMC_DMA_t *const dma, const uint8_t channel)
+{
+  XMC_DMA_HANDLERS_t *const handlers = XMC_DMA_lGetHandlers(dma);
+  XMC_DMA_CH_HANDLER_t *const handler = &handlers->channels[channel];
+  uint32_t primask;
+
+  primask = XMC_EnterCriticalSection();
+
+  if (handler->allocated == true)
   {
-    event = XMC_DMA_GetChannelsSourceTransactionCompleteStatus(dma);
-    while (event != 0)
+    if (handler->src_line != XMC_DMA_NO_LINE)
     {
-      mask = (uint32_t)1U << channel;
-      if (event & mask)
-      {
-        event_handler = dma_event_handlers[channel];
-
-        /* Call user callback to handle event */
-        if (event_handler != NULL)
-        {
-          event_handler(XMC_DMA_CH_EVENT_SRC_TRANSACTION_COMPLETE);
-        }
+      XMC_DMA_DisableRequestLine(dma, handler->src_line);
+      handlers->reserved_lines &= ~((uint32_t)1U << handler->src_line);
+    }
 
-        XMC_DMA_CH_ClearEventStatus(dma, (uint8_t)channel, (uint32_t)XMC_DMA_CH_EVENT_SRC_TRANSACTION_COMPLETE);
-        
-        break;
-      }
-      ++channel;
+    if (handler->dst_line != XMC_DMA_NO_LINE)
+    {
+      XMC_DMA_DisableRequestLine(dma, handler->dst_line);
+      handlers->reserved_lines &= ~((uint32_t)1U << handler->dst_line);
     }
+
+    handler->allocated = false;
+    handler->owner = NULL;
+    handler->bytes_per_second = 0U;
+    handler->priority = XMC_DMA_CH_PRIORITY_0;
   }
-  else if ((event & (uint32_t)XMC_DMA_CH_EVENT_DST_TRANSACTION_COMPLETE) != (uint32_t)0UL)
+
+  XMC_ExitCriticalSection(primask);
+}
+
+/* Get DMA channel allocation */
+void XMC_DMA_CH_GetInfo(XMC_DMA_t *const dma, const uint8_t channel, XMC_DMA_CH_INFO_t *const info)
+{
+  const XMC_DMA_CH_HANDLER_t *const handler = &XMC_DMA_lGetHandlers(dma)->channels[channel];
+
+  info->allocated = handler->allocated;
+  info->owner = handler->owner;
+  info->bytes_per_second = handler->bytes_per_second;
+  info->priority = handler->priority;
+  info->src_line = handler->allocated ? handler->src_line : XMC_DMA_NO_LINE;
+  info->dst_line = handler->allocated ? handler->dst_line : XMC_DMA_NO_LINE;
+  info->fifo_size = (uint8_t)XMC_DMA_lGetFifoSize(dma, channel);
+  info->linked_list = XMC_DMA_lIsLinkedListChannel(dma, channel);
+  info->enabled = XMC_DMA_CH_IsEnabled(dma, channel);
+}
+
+/* Get expected load of a DMA module */
+uint32_t XMC_DMA_GetAllocatedLoad(XMC_DMA_t *const dma)
+{
+  const XMC_DMA_HANDLERS_t *const handlers = XMC_DMA_lGetHandlers(dma);
+  uint32_t load;
+  uint32_t idx;
+
+  load = 0U;
+  for (idx = 0U; idx < handlers->num_channels; ++idx)
   {
-    event = XMC_DMA_GetChannelsDestinationTransactionCompleteStatus(dma);
-    while (event != 0)
+    if (handlers->channels[idx].allocated == true)
     {
-      mask = (uint32_t)1U << channel;
-      if (event & mask)
-      {
-        event_handler = dma_event_handlers[channel];
+      load += handlers->channels[idx].bytes_per_second;
+    }
+  }
 
-        /* Call user callback to handle event */
-        if (event_handler != NULL)
-        {
-          event_handler(XMC_DMA_CH_EVENT_DST_TRANSACTION_COMPLETE);
-        }
-        
-        XMC_DMA_CH_ClearEventStatus(dma, (uint8_t)channel, (uint32_t)XMC_DMA_CH_EVENT_DST_TRANSACTION_COMPLETE);
+  return load;
+}
 
-        break;
-      }
-      ++channel;
-    }
+/* Widest transfer width to which an address is aligned */
+static XMC_DMA_CH_TRANSFER_WIDTH_t XMC_DMA_lGetMemcpyWidth(const uint32_t align)
+{
+  XMC_DMA_CH_TRANSFER_WIDTH_t width;
+
+  if ((align & 0x3U) == 0U)
+  {
+    width = XMC_DMA_CH_TRANSFER_WIDTH_32;
   }
-  else
+  else if ((align & 0x1U) == 0U)
   {
-    /* no active interrupt was found? */
+    width = XMC_DMA_CH_TRANSFER_WIDTH_16;
   }
+  else
+  {
+    width = XMC_DMA_CH_TRANSFER_WIDTH_8;
+  }
+
+  return width;
+}
+
+/* Program and enable the channel for the next part of the oldest request */
+static XMC_DMA_CH_STATUS_t XMC_DMA_lStartMemcpy(XMC_DMA_MEMCPY_t *const engine)
+{
+  const XMC_DMA_MEMCPY_REQUEST_t *const request = &engine->requests[engine->tail];
+  XMC_DMA_CH_CONFIG_t config;
+  XMC_DMA_CH_STATUS_t status;
+  XMC_DMA_CH_TRANSFER_WIDTH_t width;
+  uint32_t remaining;
+  uint32_t block_bytes;
+  uint32_t bytes;
+  uint32_t src_addr;
+  uint32_t dst_addr;
+  uint32_t idx;
+
+  memset(&config, 0, sizeof(config));
+
+  remaining = request->size - engine->offset;
+  dst_addr = request->dst_addr + engine->offset;
+
+  if (request->fill == true)
+  {
+    /* Read the fill word from a fixed address */
+    engine->fill_word = (uint32_t)request->value * DMA_MEMCPY_FILL_PATTERN;
+    src_addr = (uint32_t)&engine->fill_word;
+    width = XMC_DMA_lGetMemcpyWidth(dst_addr);
+    config.src_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+  }
+  else
+  {
+    src_addr = request->src_addr + engine->offset;
+    width = XMC_DMA_lGetMemcpyWidth(src_addr | dst_addr);
+    config.src_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+  }
+
+  if (remaining < ((uint32_t)1U << (uint32_t)width))
+  {
+    /* Shorter than one transfer of the aligned width */
+    width = XMC_DMA_CH_TRANSFER_WIDTH_8;
+  }
+  else
+  {
+    /* Whole transfers only, the last bytes are copied by the CPU on completion */
+    remaining &= ~(((uint32_t)1U << (uint32_t)width) - 1U);
+  }
+
+  config.enable_interrupt = 1U;
+  config.src_transfer_width = (uint32_t)width;
+  config.dst_transfer_width = (uint32_t)width;
+  config.dst_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+  config.transfer_flow = (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_M2M_DMA;
+  config.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_SINGLE_BLOCK;
+  config.priority = XMC_DMA_CH_PRIORITY_0;
+  config.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_SOFTWARE;
+  config.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_SOFTWARE;
+
+  if ((engine->dma == XMC_DMA0) && (engine->channel < (uint8_t)XMC_DMA_LLI_NUM_CHANNELS))
+  {
+    /* Channels with the larger FIFO take 8 word bursts */
+    config.src_burst_length = (uint32_t)XMC_DMA_CH_BURST_LENGTH_8;
+    config.dst_burst_length = (uint32_t)XMC_DMA_CH_BURST_LENGTH_8;
+  }
+
+  block_bytes = XMC_DMA_LLI_MAX_BLOCK_SIZE << (uint32_t)width;
+  engine->chunk = 0U;
+
+  if (engine->chain != NULL)
+  {
+    idx = 0U;
+    do
+    {
+      bytes = (remaining < block_bytes) ? remaining : block_bytes;
+
+      engine->chain[idx].src_addr = src_addr;
+      engine->chain[idx].dst_addr = dst_addr;
+      engine->chain[idx].control = config.control | (uint32_t)GPDMA_CH_CTLL_LLP_EN_Msk;
+      engine->chain[idx].block_size = bytes >> (uint32_t)width;
+      engine->chain[idx].src_status = 0U;
+      engine->chain[idx].dst_status = 0U;
+      engine->chain[idx].llp = &engine->chain[idx + 1U];
+
+      if (request->fill == false)
+      {
+        src_addr += bytes;
+      }
+      dst_addr += bytes;
+      remaining -= bytes;
+      engine->chunk += bytes;
+      ++idx;
+    } while ((remaining > 0U) && (idx < engine->chain_size));
+
+    XMC_DMA_LLI_EndChain(&engine->chain[idx - 1U]);
+
+    status = XMC_DMA_CH_InitLinkedList(engine->dma, engine->channel, &config, engine->chain);
+  }
+  else
+  {
+    bytes = (remaining < block_bytes) ? remaining : block_bytes;
+
+    config.src_addr = src_addr;
+    config.dst_addr = dst_addr;
+    config.block_size = (uint16_t)(bytes >> (uint32_t)width);
+    engine->chunk = bytes;
+
+    status = XMC_DMA_CH_Init(engine->dma, engine->channel, &config);
+  }
+
+  if (status == XMC_DMA_CH_STATUS_OK)
+  {
+    XMC_DMA_CH_Enable(engine->dma, engine->channel);
+  }
+
+  return status;
+}
+
+/* Copy the bytes of the oldest request left over after its last whole transfer */
+static void XMC_DMA_lCopyMemcpyTail(const XMC_DMA_MEMCPY_t *const engine)
+{
+  const XMC_DMA_MEMCPY_REQUEST_t *const request = &engine->requests[engine->tail];
+  uint32_t tail;
+
+  tail = request->size - engine->offset;
+  if (request->fill == true)
+  {
+    memset((void *)(request->dst_addr + engine->offset), (int32_t)request->value, tail);
+  }
+  else
+  {
+    memcpy((void *)(request->dst_addr + engine->offset), (const void *)(request->src_addr + engine->offset), tail);
+  }
+}
+
+/* Remove the oldest request and run its completion handler */
+static void XMC_DMA_lCompleteMemcpy(XMC_DMA_MEMCPY_t *const engine, const XMC_DMA_CH_STATUS_t status)
+{
+  const XMC_DMA_MEMCPY_REQUEST_t *const request = &engine->requests[engine->tail];
+  XMC_DMA_MEMCPY_HANDLER_t handler;
+  void *context;
+  uint8_t next;
+
+  handler = request->handler;
+  context = request->context;
+
+  next = XMC_RING_GetNextIndex(engine->tail, engine->size);
+
+  engine->offset = 0U;
+  engine->tail = next;
+
+  if (handler != NULL)
+  {
+    handler(status, context);
+  }
+}
+
+/*
+ * Run queued requests until one is left on the channel or the queue is empty.
+ * The caller owns the engine, i.e. it has set the active flag.
+ */
+static void XMC_DMA_lRunMemcpy(XMC_DMA_MEMCPY_t *const engine)
+{
+  const XMC_DMA_MEMCPY_REQUEST_t *request;
+  XMC_DMA_CH_STATUS_t status;
+  uint32_t primask;
+  bool running;
+
+  running = true;
+  while (running == true)
+  {
+    primask = XMC_EnterCriticalSection();
+
+    if (engine->head == engine->tail)
+    {
+      /* Queue is empty, release the engine */
+      engine->active = false;
+      running = false;
+      XMC_ExitCriticalSection(primask);
+    }
+    else
+    {
+      XMC_ExitCriticalSection(primask);
+
+      request = &engine->requests[engine->tail];
+      if ((engine->offset == 0U) && ((request->size < engine->cpu_threshold) || (request->size == 0U)))
+      {
+        if (request->fill == true)
+        {
+          memset((void *)request->dst_addr, (int32_t)request->value, request->size);
+        }
+        else
+        {
+          memcpy((void *)request->dst_addr, (const void *)request->src_addr, request->size);
+        }
+        XMC_DMA_lCompleteMemcpy(engine, XMC_DMA_CH_STATUS_OK);
+      }
+      else
+      {
+        status = XMC_DMA_lStartMemcpy(engine);
+        if (status == XMC_DMA_CH_STATUS_OK)
+        {
+          /* The channel owns the engine until its completion event */
+          running = false;
+        }
+        else
+        {
+          XMC_DMA_lCompleteMemcpy(engine, status);
+        }
+      }
+    }
+  }
+}
+
+/* Channel event handler of the memory copy engine */
+static void XMC_DMA_lMemcpyEventHandler(XMC_DMA_CH_EVENT_t event, void *context)
+{
+  XMC_DMA_MEMCPY_t *const engine = (XMC_DMA_MEMCPY_t *)context;
+  const XMC_DMA_MEMCPY_REQUEST_t *const request = &engine->requests[engine->tail];
+
+  if (event == XMC_DMA_CH_EVENT_ERROR)
+  {
+    XMC_DMA_CH_Disable(engine->dma, engine->channel);
+    XMC_DMA_lCompleteMemcpy(engine, XMC_DMA_CH_STATUS_ERROR);
+  }
+  else
+  {
+    engine->offset += engine->chunk;
+    if ((request->size - engine->offset) < DMA_MEMCPY_WORD_SIZE)
+    {
+      XMC_DMA_lCopyMemcpyTail(engine);
+      XMC_DMA_lCompleteMemcpy(engine, XMC_DMA_CH_STATUS_OK);
+    }
+  }
+
+  XMC_DMA_lRunMemcpy(engine);
+}
+
+/* Queue a request and start the engine if it is idle */
+static XMC_DMA_CH_STATUS_t XMC_DMA_lQueueMemcpy(XMC_DMA_MEMCPY_t *const engine,
+                                                const XMC_DMA_MEMCPY_REQUEST_t *const request)
+{
+  XMC_DMA_CH_STATUS_t status;
+  uint32_t primask;
+  uint8_t next;
+  bool start;
+
+  start = false;
+  primask = XMC_EnterCriticalSection();
+
+  next = XMC_RING_GetNextIndex(engine->head, engine->size);
+
+  if (next == engine->tail)
+  {
+    /* Queue is full */
+    status = XMC_DMA_CH_STATUS_BUSY;
+  }
+  else
+  {
+    engine->requests[engine->head] = *request;
+    engine->head = next;
+
+    if (engine->active == false)
+    {
+      engine->active = true;
+      start = true;
+    }
+    status = XMC_DMA_CH_STATUS_OK;
+  }
+
+  XMC_ExitCriticalSection(primask);
+
+  if (start == true)
+  {
+    XMC_DMA_lRunMemcpy(engine);
+  }
+
+  return status;
+}
+
+/* Initialize DMA memory copy engine */
+XMC_DMA_CH_STATUS_t XMC_DMA_MEMCPY_Init(XMC_DMA_MEMCPY_t *const engine,
+                                        XMC_DMA_t *const dma,
+                                        const uint8_t channel,
+                                        XMC_DMA_MEMCPY_REQUEST_t *const requests,
+                                        const uint8_t size,
+                                        XMC_DMA_LLI_t *const chain,
+                                        const uint8_t chain_size,
+                                        const uint32_t cpu_threshold)
+{
+  XMC_DMA_CH_STATUS_t status;
+
+  XMC_ASSERT("XMC_DMA_MEMCPY_Init: requests is invalid", (requests != NULL) && (size > 1U));
+
+  if ((XMC_DMA_IsEnabled(dma) == false) ||
+      ((chain != NULL) && ((dma != XMC_DMA0) || (channel >= (uint8_t)XMC_DMA_LLI_NUM_CHANNELS) || (chain_size == 0U))))
+  {
+    status = XMC_DMA_CH_STATUS_ERROR;
+  }
+  else
+  {
+    engine->dma = dma;
+    engine->channel = channel;
+    engine->requests = requests;
+    engine->size = size;
+    engine->head = 0U;
+    engine->tail = 0U;
+    engine->active = false;
+    engine->chain = chain;
+    engine->chain_size = chain_size;
+    engine->cpu_threshold = cpu_threshold;
+    engine->offset = 0U;
+    engine->chunk = 0U;
+
+    XMC_DMA_CH_SetEventHandlerContext(dma, channel, XMC_DMA_lMemcpyEventHandler, engine);
+    XMC_DMA_CH_EnableEvent(dma, channel, (uint32_t)((uint32_t)XMC_DMA_CH_EVENT_TRANSFER_COMPLETE |
+                                                   (uint32_t)XMC_DMA_CH_EVENT_ERROR));
+    status = XMC_DMA_CH_STATUS_OK;
+  }
+
+  return status;
+}
+
+/* Queue a memory copy */
+XMC_DMA_CH_STATUS_t XMC_DMA_MEMCPY_Copy(XMC_DMA_MEMCPY_t *const engine,
+                                        void *const dst,
+                                        const void *const src,
+                                        const uint32_t size,
+                                        XMC_DMA_MEMCPY_HANDLER_t handler,
+                                        void *const context)
+{
+  XMC_DMA_MEMCPY_REQUEST_t request;
+
+  request.dst_addr = (uint32_t)dst;
+  request.src_addr = (uint32_t)src;
+  request.size = size;
+  request.handler = handler;
+  request.context = context;
+  request.value = 0U;
+  request.fill = false;
+
+  return XMC_DMA_lQueueMemcpy(engine, &request);
+}
+
+/* Queue a memory fill */
+XMC_DMA_CH_STATUS_t XMC_DMA_MEMCPY_Fill(XMC_DMA_MEMCPY_t *const engine,
+                                        void *const dst,
+                                        const uint8_t value,
+                                        const uint32_t size,
+                                        XMC_DMA_MEMCPY_HANDLER_t handler,
+                                        void *const context)
+{
+  XMC_DMA_MEMCPY_REQUEST_t request;
+
+  request.dst_addr = (uint32_t)dst;
+  request.src_addr = 0U;
+  request.size = size;
+  request.handler = handler;
+  request.context = context;
+  request.value = value;
+  request.fill = true;
+
+  return XMC_DMA_lQueueMemcpy(engine, &request);
+}
+
+/*
+ * Segments completed since the last event. Block completions that occur before the interrupt is
+ * serviced raise a single event, so the count is derived from the channel position. Zero means
+ * the completion was already accounted by the previous event.
+ */
+static uint32_t XMC_DMA_lGetCompletedSegments(const XMC_DMA_STREAM_t *const stream)
+{
+  uint32_t current;
+  uint32_t count;
+
+  if (stream->num_segments == 1U)
+  {
+    /* An auto-reloaded segment restarts at the same address, every event is one segment */
+    count = 1U;
+  }
+  else
+  {
+    /* Segment in transfer, the position is at the buffer end until the next item is fetched */
+    current = (XMC_DMA_STREAM_GetPosition(stream) / stream->segment_bytes) % (uint32_t)stream->num_segments;
+    count = ((current + (uint32_t)stream->num_segments) - (uint32_t)stream->segment) % (uint32_t)stream->num_segments;
+  }
+
+  return count;
+}
+
+/* Account one completed segment and report it */
+static void XMC_DMA_lStreamSegmentComplete(XMC_DMA_STREAM_t *const stream, uint32_t events)
+{
+  uint32_t segment;
+
+  segment = stream->segment;
+  events |= (uint32_t)XMC_DMA_STREAM_EVENT_SEGMENT_COMPLETE;
+
+  if (segment == ((uint32_t)stream->num_segments - 1U))
+  {
+    events |= (uint32_t)XMC_DMA_STREAM_EVENT_FULL_COMPLETE;
+    stream->segment = 0U;
+  }
+  else
+  {
+    if (segment == (((uint32_t)stream->num_segments / 2U) - 1U))
+    {
+      events |= (uint32_t)XMC_DMA_STREAM_EVENT_HALF_COMPLETE;
+    }
+    ++stream->segment;
+  }
+
+  if (stream->filled < stream->num_segments)
+  {
+    ++stream->filled;
+  }
+
+  /* A single auto-reloaded segment is always rewritten at once, it is read through the fill position */
+  if ((stream->num_segments > 1U) && (stream->filled == stream->num_segments))
+  {
+    /* The channel is now transferring the oldest unreleased segment */
+    events |= (uint32_t)XMC_DMA_STREAM_EVENT_OVERRUN;
+    ++stream->overruns;
+    stream->filled = stream->num_segments - 1U;
+  }
+
+  if (stream->handler != NULL)
+  {
+    stream->handler(events, segment, stream->context);
+  }
+}
+
+/* Channel event handler of a DMA stream */
+static void XMC_DMA_lStreamEventHandler(XMC_DMA_CH_EVENT_t event, void *context)
+{
+  XMC_DMA_STREAM_t *const stream = (XMC_DMA_STREAM_t *)context;
+  uint32_t count;
+  uint32_t events;
+
+  if (event == XMC_DMA_CH_EVENT_ERROR)
+  {
+    if (stream->handler != NULL)
+    {
+      stream->handler((uint32_t)XMC_DMA_STREAM_EVENT_ERROR, stream->segment, stream->context);
+    }
+  }
+  else
+  {
+    events = 0U;
+    if ((stream->line != XMC_DMA_STREAM_NO_LINE) && (XMC_DMA_GetOverrunStatus(stream->dma, stream->line) == true))
+    {
+      events = (uint32_t)XMC_DMA_STREAM_EVENT_REQUEST_OVERRUN;
+      ++stream->request_overruns;
+      XMC_DMA_ClearOverrunStatus(stream->dma, stream->line);
+    }
+
+    /* Report every segment on its own, the request overrun with the first one */
+    for (count = XMC_DMA_lGetCompletedSegments(stream); count > 0U; --count)
+    {
+      XMC_DMA_lStreamSegmentComplete(stream, events);
+      events = 0U;
+    }
+  }
+}
 
+/* Initialize DMA stream */
+XMC_DMA_CH_STATUS_t XMC_DMA_STREAM_Init(XMC_DMA_STREAM_t *const stream,
+                                        XMC_DMA_t *const dma,
+                                        const uint8_t channel,
+                                        const XMC_DMA_CH_CONFIG_t *const config,
+                                        const XMC_DMA_STREAM_CONFIG_t *const stream_config)
+{
+  XMC_DMA_CH_CONFIG_t ch_config;
+  XMC_DMA_CH_STATUS_t status;
+  uint32_t mem_addr;
+  uint32_t idx;
+  uint8_t request;
+  bool hardware;
+  bool valid;
+
+  ch_config = *config;
+  ch_config.enable_interrupt = 1U;
+
+  switch ((XMC_DMA_CH_TRANSFER_FLOW_t)config->transfer_flow)
+  {
+    case XMC_DMA_CH_TRANSFER_FLOW_P2M_DMA:
+    case XMC_DMA_CH_TRANSFER_FLOW_P2M_PER:
+      stream->memory_is_dst = true;
+      hardware = (config->src_handshaking == XMC_DMA_CH_SRC_HANDSHAKING_HARDWARE);
+      request = config->src_peripheral_request;
+      valid = true;
+      break;
+
+    case XMC_DMA_CH_TRANSFER_FLOW_M2P_DMA:
+    case XMC_DMA_CH_TRANSFER_FLOW_M2P_PER:
+      stream->memory_is_dst = false;
+      hardware = (config->dst_handshaking == XMC_DMA_CH_DST_HANDSHAKING_HARDWARE);
+      request = config->dst_peripheral_request;
+      valid = true;
+      break;
+
+    default:
+      hardware = false;
+      request = 0U;
+      valid = false;
+      break;
+  }
+
+  /* Looping linked lists and address reload both exist on GPDMA0 channels 0 and 1 only */
+  valid = valid &&
+          (dma == XMC_DMA0) &&
+          (channel < XMC_DMA_LLI_NUM_CHANNELS) &&
+          (stream_config->buffer != NULL) &&
+          (stream_config->segment_size > 0U) &&
+          (stream_config->segment_size <= XMC_DMA_LLI_MAX_BLOCK_SIZE) &&
+          (stream_config->num_segments > 0U) &&
+          ((stream_config->chain != NULL) || (stream_config->num_segments == 1U));
+
+  if (valid == false)
+  {
+    status = XMC_DMA_CH_STATUS_ERROR;
+  }
+  else
+  {
+    stream->dma = dma;
+    stream->channel = channel;
+    stream->buffer = (uint8_t *)stream_config->buffer;
+    stream->chain = stream_config->chain;
+    stream->handler = stream_config->handler;
+    stream->context = stream_config->context;
+    stream->num_segments = stream_config->num_segments;
+    stream->segment_bytes = (uint32_t)stream_config->segment_size << config->src_transfer_width;
+    stream->segment = 0U;
+    stream->filled = 0U;
+    stream->overruns = 0U;
+    stream->request_overruns = 0U;
+    stream->line = XMC_DMA_STREAM_NO_LINE;
+
+    if (hardware == true)
+    {
+#if defined(GPDMA1)
+      if (dma == XMC_DMA0)
+      {
+#endif
+        stream->line = request & GPDMA0_CH_CFGH_PER_Msk;
+#if defined(GPDMA1)
+      }
+      else
+      {
+        stream->line = request & GPDMA1_CH_CFGH_PER_Msk;
+      }
+#endif
+    }
+
+    mem_addr = (uint32_t)stream->buffer;
+    ch_config.block_size = stream_config->segment_size;
+    if (stream->memory_is_dst == true)
+    {
+      ch_config.dst_addr = mem_addr;
+    }
+    else
+    {
+      ch_config.src_addr = mem_addr;
+    }
+
+    if (stream->chain != NULL)
+    {
+      /* One looping item per segment, the channel fetches the next one without CPU intervention */
+      for (idx = 0U; idx < stream->num_segments; ++idx)
+      {
+        stream->chain[idx].src_addr = ch_config.src_addr;
+        stream->chain[idx].dst_addr = ch_config.dst_addr;
+        stream->chain[idx].control = ch_config.control | (uint32_t)GPDMA_CH_CTLL_LLP_EN_Msk;
+        stream->chain[idx].block_size = stream_config->segment_size;
+        stream->chain[idx].src_status = 0U;
+        stream->chain[idx].dst_status = 0U;
+        stream->chain[idx].llp = &stream->chain[(idx + 1U) % stream->num_segments];
+
+        if (stream->memory_is_dst == true)
+        {
+          stream->chain[idx].dst_addr = mem_addr;
+        }
+        else
+        {
+          stream->chain[idx].src_addr = mem_addr;
+        }
+        mem_addr += stream->segment_bytes;
+      }
+
+      status = XMC_DMA_LLI_ValidateChain(stream->chain, stream->num_segments);
+      if (status == XMC_DMA_CH_STATUS_OK)
+      {
+        status = XMC_DMA_CH_InitLinkedList(dma, channel, &ch_config, stream->chain);
+      }
+    }
+    else
+    {
+      ch_config.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_MULTI_BLOCK_SRCADR_RELOAD_DSTADR_RELOAD;
+      status = XMC_DMA_CH_Init(dma, channel, &ch_config);
+    }
+
+    if (status == XMC_DMA_CH_STATUS_OK)
+    {
+      XMC_DMA_CH_SetEventHandlerContext(dma, channel, XMC_DMA_lStreamEventHandler, stream);
+      XMC_DMA_CH_EnableEvent(dma, channel, (uint32_t)((uint32_t)XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE |
+                                                     (uint32_t)XMC_DMA_CH_EVENT_ERROR));
+    }
+  }
+
+  return status;
+}
+
+/* Start DMA stream */
+void XMC_DMA_STREAM_Start(XMC_DMA_STREAM_t *const stream)
+{
+  stream->segment = 0U;
+  stream->filled = 0U;
+
+  if (stream->line != XMC_DMA_STREAM_NO_LINE)
+  {
+    XMC_DMA_ClearOverrunStatus(stream->dma, stream->line);
+  }
+
+  XMC_DMA_CH_Enable(stream->dma, stream->channel);
+}
+
+/* Stop DMA stream */
+void XMC_DMA_STREAM_Stop(XMC_DMA_STREAM_t *const stream)
+{
+  XMC_DMA_CH_Disable(stream->dma, stream->channel);
+}
+
+/* Release processed segments */
+void XMC_DMA_STREAM_Release(XMC_DMA_STREAM_t *const stream, const uint32_t count)
+{
+  uint32_t primask;
+
+  primask = XMC_EnterCriticalSection();
+
+  if (count < stream->filled)
+  {
+    stream->filled -= (uint8_t)count;
+  }
+  else
+  {
+    stream->filled = 0U;
+  }
+
+  XMC_ExitCriticalSection(primask);
+}
+
+/* Get DMA stream fill position */
+uint32_t XMC_DMA_STREAM_GetPosition(const XMC_DMA_STREAM_t *const stream)
+{
+  uint32_t addr;
+
+  if (stream->memory_is_dst == true)
+  {
+    addr = stream->dma->CH[stream->channel].DAR;
+  }
+  else
+  {
+    addr = stream->dma->CH[stream->channel].SAR;
+  }
+
+  return (addr - (uint32_t)stream->buffer);
+}
+
+#if defined(XMC_DMA_INSTRUMENTATION_ENABLE)
+/* Clear the statistics of a channel */
+static void XMC_DMA_lClearStatistics(XMC_DMA_CH_STATISTICS_t *const stats)
+{
+  memset(stats, 0, sizeof(XMC_DMA_CH_STATISTICS_t));
+  stats->min_latency = 0xffffffffUL;
+}
+
+/* Check if a linked list item is the last one the channel runs */
+__STATIC_INLINE bool XMC_DMA_lIsLastItem(const XMC_DMA_LLI_t *const lli)
+{
+  return ((lli->llp == NULL) || ((lli->control & GPDMA_CH_CTLL_LLP_EN_Msk) == 0U));
+}
+
+/*
+ * Account the linked list items completed since the last event. Block complete events merge,
+ * so one event may stand for several items. The channel's LLP register points behind the item
+ * in transfer, the items before that one are complete. Until the channel has fetched the next
+ * item, it still points behind the completed one, which is then accounted alone.
+ */
+static void XMC_DMA_lRecordItems(const XMC_DMA_t *const dma,
+                                 XMC_DMA_CH_HANDLER_t *const handler,
+                                 const uint8_t channel,
+                                 const bool transfer_complete)
+{
+  XMC_DMA_CH_STATISTICS_t *const stats = &handler->stats;
+  const XMC_DMA_LLI_t *lli = handler->lli;
+  uint32_t llp;
+  uint32_t count;
+  bool done;
+
+  llp = dma->CH[channel].LLP & GPDMA0_CH_LLP_LOC_Msk;
+  count = 0U;
+  done = false;
+
+  while ((lli != NULL) && (done == false) && (count < DMA_LLI_MAX_WALK))
+  {
+    if (transfer_complete == true)
+    {
+      /* The whole list is done, account up to the last item */
+      done = XMC_DMA_lIsLastItem(lli);
+    }
+    else if ((count != 0U) && ((uint32_t)lli->llp == llp))
+    {
+      /* Item in transfer */
+      done = true;
+      lli = (const XMC_DMA_LLI_t *)NULL;
+    }
+    else
+    {
+      /* The first item has completed, the event says so */
+    }
+
+    if (lli != NULL)
+    {
+      stats->bytes += (uint64_t)((lli->block_size & GPDMA0_CH_CTLH_BLOCK_TS_Msk) << lli->src_transfer_width);
+      lli = XMC_DMA_lIsLastItem(lli) ? (const XMC_DMA_LLI_t *)NULL : lli->llp;
+      ++count;
+    }
+  }
+
+  handler->lli = lli;
+}
+
+/* Record a serviced event in the channel statistics */
+static void XMC_DMA_lRecordEvent(const XMC_DMA_t *const dma,
+                                 XMC_DMA_CH_HANDLER_t *const handler,
+                                 const uint8_t channel,
+                                 const uint32_t event_idx)
+{
+  XMC_DMA_CH_STATISTICS_t *const stats = &handler->stats;
+  uint32_t latency;
+  uint32_t bin;
+
+  if (event_idx == 4U)
+  {
+    /* Error, the channel has been disabled by the hardware */
+    ++stats->errors;
+    handler->timing = false;
+  }
+  else if (event_idx <= 1U)
+  {
+    /* Transfer or block complete. The channel registers already hold the next linked list item, so walk the list instead */
+    if (handler->lli != NULL)
+    {
+      XMC_DMA_lRecordItems(dma, handler, channel, (event_idx == 0U));
+    }
+    else
+    {
+      /* An auto-reloaded block restarts at the same address, merged events cannot be told apart */
+      stats->bytes += (uint64_t)handler->block_bytes;
+    }
+
+    if ((event_idx == 0U) && (handler->timing == true))
+    {
+      latency = DWT->CYCCNT - handler->enable_timestamp;
+      handler->timing = false;
+
+      ++stats->transfers;
+      stats->busy_cycles += latency;
+      if (latency < stats->min_latency)
+      {
+        stats->min_latency = latency;
+      }
+      if (latency > stats->max_latency)
+      {
+        stats->max_latency = latency;
+      }
+
+      bin = 31U - (uint32_t)__CLZ(latency | 1U);
+      bin = (bin < DMA_LATENCY_BIN_SHIFT) ? 0U : (bin - DMA_LATENCY_BIN_SHIFT + 1U);
+      if (bin >= XMC_DMA_CH_LATENCY_BINS)
+      {
+        bin = XMC_DMA_CH_LATENCY_BINS - 1U;
+      }
+      ++stats->latency_histogram[bin];
+    }
+  }
+  else
+  {
+    /* Transaction events carry no transfer statistics */
+  }
+}
+
+/* Start the DWT cycle counter */
+void XMC_DMA_InitInstrumentation(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  XMC_DMA_ClearInstrumentation(XMC_DMA0);
+#if defined(GPDMA1)
+  XMC_DMA_ClearInstrumentation(XMC_DMA1);
+#endif
+}
+
+/* Record the enable time of a channel */
+void XMC_DMA_CH_RecordEnable(XMC_DMA_t *const dma, const uint8_t channel)
+{
+  XMC_DMA_CH_HANDLER_t *const handler = &XMC_DMA_lGetHandlers(dma)->channels[channel];
+  uint32_t width;
+
+  if ((dma->CH[channel].CTLL & GPDMA_CH_CTLL_LLP_EN_Msk) != 0U)
+  {
+    /* Block sizes are taken from the linked list items as they complete */
+    handler->lli = (const XMC_DMA_LLI_t *)(dma->CH[channel].LLP & GPDMA0_CH_LLP_LOC_Msk);
+    handler->block_bytes = 0U;
+  }
+  else
+  {
+    /* Single or auto-reloaded block, the size does not change while the channel runs */
+    width = (dma->CH[channel].CTLL & GPDMA0_CH_CTLL_SRC_TR_WIDTH_Msk) >> GPDMA0_CH_CTLL_SRC_TR_WIDTH_Pos;
+    handler->lli = NULL;
+    handler->block_bytes = (dma->CH[channel].CTLH & GPDMA0_CH_CTLH_BLOCK_TS_Msk) << width;
+  }
+
+  handler->enable_timestamp = DWT->CYCCNT;
+  handler->timing = true;
+}
+
+/* Take a snapshot of the instrumentation */
+void XMC_DMA_GetInstrumentationSnapshot(XMC_DMA_t *const dma, XMC_DMA_INSTRUMENTATION_SNAPSHOT_t *const snapshot)
+{
+  const XMC_DMA_HANDLERS_t *const handlers = XMC_DMA_lGetHandlers(dma);
+  uint32_t primask;
+  uint32_t idx;
+
+  primask = XMC_EnterCriticalSection();
+
+  snapshot->timestamp = DWT->CYCCNT;
+  snapshot->elapsed = snapshot->timestamp - handlers->clear_timestamp;
+  snapshot->num_channels = handlers->num_channels;
+  for (idx = 0U; idx < handlers->num_channels; ++idx)
+  {
+    snapshot->channels[idx] = handlers->channels[idx].stats;
+  }
+
+  XMC_ExitCriticalSection(primask);
+}
+
+/* Clear the instrumentation */
+void XMC_DMA_ClearInstrumentation(XMC_DMA_t *const dma)
+{
+  XMC_DMA_HANDLERS_t *const handlers = XMC_DMA_lGetHandlers(dma);
+  uint32_t primask;
+  uint32_t idx;
+
+  primask = XMC_EnterCriticalSection();
+
+  for (idx = 0U; idx < handlers->num_channels; ++idx)
+  {
+    XMC_DMA_lClearStatistics(&handlers->channels[idx].stats);
+  }
+  handlers->clear_timestamp = DWT->CYCCNT;
+
+  XMC_ExitCriticalSection(primask);
+}
+#endif
+
+/* Default DMA IRQ handler */
+void XMC_DMA_IRQHandler(XMC_DMA_t *const dma)
+{
+  XMC_DMA_HANDLERS_t *const handlers = XMC_DMA_lGetHandlers(dma);
+  XMC_DMA_CH_HANDLER_t *handler;
+  XMC_DMA_CH_EVENT_t event;
+  uint32_t global_status;
+  uint32_t channels;
+  uint32_t clear_mask;
+  uint32_t event_idx;
+  uint32_t clear_idx;
+  uint32_t order_idx;
+  uint32_t channel;
+
+  ++handlers->interrupt_count;
+
+  global_status = XMC_DMA_GetEventStatus(dma);
+
+  for (order_idx = 0UL; order_idx < DMA_EVENT_MAX; ++order_idx)
+  {
+    event_idx = dma_event_order[order_idx];
+    channels = 0U;
+
+    if ((global_status & ((uint32_t)0x1UL << event_idx)) != 0U)
+    {
+      /* Channel status is read per event type, a serviced transfer complete clears the block complete status */
+      channels = dma->STATUSCHEV[event_idx * 2UL] & DMA_CH_STATUS_MSK;
+
+      /* Clear the events of all pending channels at once, before running the callbacks */
+      clear_mask = dma_event_clear_masks[event_idx];
+      for (clear_idx = 0UL; (channels != 0U) && (clear_idx < DMA_EVENT_MAX); ++clear_idx)
+      {
+        if ((clear_mask & ((uint32_t)0x1UL << clear_idx)) != 0U)
+        {
+          dma->CLEARCHEV[clear_idx * 2UL] = channels;
+        }
+      }
+    }
+
+    event = (XMC_DMA_CH_EVENT_t)((uint32_t)0x1UL << event_idx);
+    while (channels != 0U)
+    {
+      channel = 31UL - (uint32_t)__CLZ(channels);
+      channels &= ~((uint32_t)0x1UL << channel);
+
+      handler = &handlers->channels[channel];
+      ++handler->event_count[event_idx];
+
+#if defined(XMC_DMA_INSTRUMENTATION_ENABLE)
+      XMC_DMA_lRecordEvent(dma, handler, (uint8_t)channel, event_idx);
+#endif
+
+      /* Call user callback to handle event */
+      if (handler->context_handler != NULL)
+      {
+        handler->context_handler(event, handler->context);
+      }
+      else if (handler->event_handler != NULL)
+      {
+        handler->event_handler(event);
+      }
+      else
+      {
+        /* No callback registered */
+      }
+    }
+  }
 }
 
 #endif /* GPDMA0 */
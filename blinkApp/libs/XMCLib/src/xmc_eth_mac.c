@@ -37,6 +37,19 @@
  * Change History
  * --------------
  *
+ * 2026-10-17:
+ *     - Add zero-copy RX frame lending (XMC_ETH_MAC_BorrowRxFrame/XMC_ETH_MAC_ReturnRxFrame)
+ *     - Add scatter-gather zero-copy transmit (XMC_ETH_MAC_SendFrameScatter/XMC_ETH_MAC_ProcessTxDone)
+ *     - Add batched RX drain with a single DMA resume (XMC_ETH_MAC_ReadFrames/XMC_ETH_MAC_BorrowRxFrames)
+ *       and optional receive cycle counters (XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+ *     - Add interrupt coalescing with RX interrupt watchdog and adaptive policy
+ *     - Add TX checksum insertion modes and RX checksum offload status
+ *     - Add per-frame time stamp ring and PTP clock servo
+ *     - Add non-blocking MDIO request queue and link state poller, ReadPhy/WritePhy use the same primitives
+ *     - Add multicast filter manager with reference counted hash table bits
+ *     - Fix XMC_ETH_MAC_SetAddressPerfectFilter() register indexing, enable the address for comparison
+ *     - Add MMC and DMA missed frame statistics with interval deltas and transmit busy count
+ *
  * 2015-09-01:
  *     - Add clock gating control in enable/disable APIs
  *     - Add transmit polling if run out of buffers
@@ -93,6 +106,7 @@
 #define ETH_MAC_DMA_TDES0_DP   (0x04000000U) /**< Disable pad */
 #define ETH_MAC_DMA_TDES0_TTSE (0x02000000U) /**< Transmit time stamp enable */
 #define ETH_MAC_DMA_TDES0_CIC  (0x00C00000U) /**< Checksum insertion control */
+#define ETH_MAC_DMA_TDES0_CIC_Pos (22U)      /**< Checksum insertion control position */
 #define ETH_MAC_DMA_TDES0_TER  (0x00200000U) /**< Transmit end of ring */
 #define ETH_MAC_DMA_TDES0_TCH  (0x00100000U) /**< Second address chained */
 #define ETH_MAC_DMA_TDES0_TTSS (0x00020000U) /**< Transmit time stamp status */
@@ -111,6 +125,11 @@
 #define ETH_MAC_DMA_TDES0_UF   (0x00000002U) /**< Underflow error */
 #define ETH_MAC_DMA_TDES0_DB   (0x00000001U) /**< Deferred bit */
 
+/**
+ * TDES1 Descriptor TX Buffer Sizes
+ */
+#define ETH_MAC_DMA_TDES1_TBS1 (0x00001FFFU) /**< Transmit buffer 1 size */
+
 /**
  * RDES0 Descriptor RX Packet Status
  */
@@ -134,9 +153,15 @@
 #define ETH_MAC_DMA_RDES0_CE   (0x00000002U) /**< CRC error */
 #define ETH_MAC_DMA_RDES0_ESA  (0x00000001U) /**< Extended Status/Rx MAC address */
 
+/**
+ * RDES4 Descriptor RX Extended Status
+ */
+#define ETH_MAC_DMA_RDES4_IPC  (0x000000FFU) /**< IP checksum offload status */
+
 /**
  * RDES1 Descriptor RX Packet Control
  */
+#define ETH_MAC_DMA_RDES1_DIC  (0x80000000U) /**< Disable interrupt on completion */
 #define ETH_MAC_DMA_RDES1_RBS2 (0x1FFF0000U) /**< Receive buffer 2 size */
 #define ETH_MAC_DMA_RDES1_RER  (0x00008000U) /**< Receive end of ring */
 #define ETH_MAC_DMA_RDES1_RCH  (0x00004000U) /**< Second address chained */
@@ -163,6 +188,30 @@
                                 XMC_ETH_MAC_EVENT_EARLY_TRANSMIT |\
                                 XMC_ETH_MAC_EVENT_BUS_ERROR)
 
+/**
+ * IEEE 802.3 basic mode status register, used by the link state poller
+ */
+#define XMC_ETH_MAC_PHY_REG_BMSR            (0x01U)    /**< Basic mode status register address */
+#define XMC_ETH_MAC_PHY_BMSR_LINK_STATUS    (0x0004U)  /**< Link status bit */
+
+/**
+ * Multicast filter hash table
+ */
+#define XMC_ETH_MAC_HASH_TABLE_SIZE         (64U)          /**< Number of hash table bits */
+#define XMC_ETH_MAC_PERFECT_FILTER_SLOTS    (4U)           /**< MAC_ADDRESS0 to MAC_ADDRESS3, slot 0 is the station address */
+#define XMC_ETH_MAC_CRC32_POLYNOMIAL        (0xEDB88320U)  /**< Reflected IEEE 802.3 CRC-32 polynomial */
+
+/**
+ * PTP sub-second register resolution with binary rollover (2^31 per second)
+ */
+#define XMC_ETH_MAC_PTP_SUBSECONDS_PER_SECOND (0x80000000ULL)
+#define XMC_ETH_MAC_PTP_NANOSECONDS_PER_SECOND (1000000000L)
+
+/**
+ * PTP servo statistics filter weight (1/16)
+ */
+#define XMC_ETH_MAC_PTP_FILTER_SHIFT (4U)
+
 /* Definition needed in case of device header file previous to v1.5.1*/
 #ifndef ETH_BUS_MODE_ATDS_Msk
 #define ETH_BUS_MODE_ATDS_Msk  (0x00000080UL)
@@ -194,6 +243,297 @@ __STATIC_INLINE bool XCM_ETH_MAC_IsAbnormalEvent(uint32_t event)
                            (uint32_t)XMC_ETH_MAC_EVENT_BUS_ERROR)) != (uint32_t)0);
  }
 
+/* Check if a completed RX descriptor holds a complete frame received without error */
+__STATIC_INLINE bool XMC_ETH_MAC_lIsRxFrameValid(uint32_t status)
+{
+  return (((status & ETH_MAC_DMA_RDES0_ES) == 0U) &&
+          ((status & ETH_MAC_DMA_RDES0_FS) != 0U) &&
+          ((status & ETH_MAC_DMA_RDES0_LS) != 0U));
+}
+
+/* Checksum insertion control of a transmit descriptor for the checksum mode in the frame flags */
+__STATIC_INLINE uint32_t XMC_ETH_MAC_lGetTxChecksumControl(uint32_t flags)
+{
+  uint32_t cic;
+
+  switch (flags & (uint32_t)XMC_ETH_MAC_TX_FRAME_CHECKSUM_DISABLE)
+  {
+    case XMC_ETH_MAC_TX_FRAME_CHECKSUM_IP_HEADER:
+      cic = 1U;
+      break;
+
+    case XMC_ETH_MAC_TX_FRAME_CHECKSUM_IP_PAYLOAD:
+      cic = 2U;
+      break;
+
+    case XMC_ETH_MAC_TX_FRAME_CHECKSUM_DISABLE:
+      cic = 0U;
+      break;
+
+    default:
+      /* IP header, payload and pseudo-header */
+      cic = 3U;
+      break;
+  }
+
+  return (cic << ETH_MAC_DMA_TDES0_CIC_Pos);
+}
+
+/* Checksum offload status of a completed RX descriptor */
+__STATIC_INLINE uint32_t XMC_ETH_MAC_lGetRxChecksumStatus(const XMC_ETH_MAC_DMA_DESC_t *const rx_desc)
+{
+  uint32_t status = 0U;
+
+  /* Extended status is only valid for frames checked by the IPC engine */
+  if ((rx_desc->status & ETH_MAC_DMA_RDES0_ESA) != 0U)
+  {
+    status = rx_desc->extended_status & ETH_MAC_DMA_RDES4_IPC;
+  }
+
+  return status;
+}
+
+/* Queue the time stamp of a completed descriptor */
+static void XMC_ETH_MAC_lPushTimeStamp(XMC_ETH_MAC_t *const eth_mac,
+                                       const XMC_ETH_MAC_DMA_DESC_t *const desc,
+                                       const void *const tag,
+                                       XMC_ETH_MAC_TIMESTAMP_SOURCE_t source)
+{
+  XMC_ETH_MAC_TIMESTAMP_RING_t *const ring = eth_mac->ts_ring;
+  XMC_ETH_MAC_TIMESTAMP_t *entry;
+  uint32_t next;
+
+  next = (uint32_t)ring->head + 1U;
+  if (next == ring->size)
+  {
+    next = 0U;
+  }
+
+  if (next == ring->tail)
+  {
+    /* Ring is full, keep the older entries */
+    ring->overruns++;
+  }
+  else
+  {
+    entry = &ring->entries[ring->head];
+    entry->time.nanoseconds = (int32_t)desc->time_stamp_nanoseconds;
+    entry->time.seconds = desc->time_stamp_seconds;
+    entry->tag = tag;
+    entry->source = source;
+    ring->head = (uint8_t)next;
+  }
+}
+
+/* Queue the time stamp of a received frame, if one was captured */
+__STATIC_INLINE void XMC_ETH_MAC_lCaptureRxTimeStamp(XMC_ETH_MAC_t *const eth_mac,
+                                                     const XMC_ETH_MAC_DMA_DESC_t *const rx_desc,
+                                                     const void *const tag)
+{
+  if ((eth_mac->ts_ring != NULL) && ((rx_desc->status & ETH_MAC_DMA_RDES0_TSA) != 0U))
+  {
+    XMC_ETH_MAC_lPushTimeStamp(eth_mac, rx_desc, tag, XMC_ETH_MAC_TIMESTAMP_SOURCE_RX);
+  }
+}
+
+/* Queue the time stamp of a transmitted frame, if one was captured */
+__STATIC_INLINE void XMC_ETH_MAC_lCaptureTxTimeStamp(XMC_ETH_MAC_t *const eth_mac,
+                                                     const XMC_ETH_MAC_DMA_DESC_t *const tx_desc)
+{
+  if ((eth_mac->ts_ring != NULL) && ((tx_desc->status & ETH_MAC_DMA_TDES0_TTSS) != 0U))
+  {
+    XMC_ETH_MAC_lPushTimeStamp(eth_mac, tx_desc, (const void *)tx_desc->reserved, XMC_ETH_MAC_TIMESTAMP_SOURCE_TX);
+  }
+}
+
+/* Give the current RX descriptor back to DMA */
+__STATIC_INLINE void XMC_ETH_MAC_lReturnRxDescriptor(XMC_ETH_MAC_t *const eth_mac)
+{
+  eth_mac->rx_desc[eth_mac->rx_index].status = ETH_MAC_DMA_RDES0_OWN;
+
+  eth_mac->rx_index++;
+  if (eth_mac->rx_index == eth_mac->num_rx_buf)
+  {
+    eth_mac->rx_index = 0U;
+  }
+}
+
+/* Resume reception if the DMA was suspended for lack of descriptors */
+__STATIC_INLINE void XMC_ETH_MAC_lResumeRx(XMC_ETH_MAC_t *const eth_mac)
+{
+  if (eth_mac->regs->STATUS & ETH_STATUS_RU_Msk)
+  {
+    /* Receive buffer unavailable, resume DMA */
+    eth_mac->regs->STATUS = (uint32_t)ETH_STATUS_RU_Msk;
+    eth_mac->regs->RECEIVE_POLL_DEMAND = 0U;
+  }
+}
+
+/*
+ * Initialize RX descriptors. With keep_buffers, every descriptor keeps its current buffer: after frames
+ * have been lent, the static buffers may be in the pool or with the application.
+ */
+static void XMC_ETH_MAC_lInitRxDescriptors(XMC_ETH_MAC_t *const eth_mac, const bool keep_buffers)
+{
+  uint32_t i;
+  uint32_t next;
+
+  /*
+   * Chained structure (ETH_MAC_DMA_RDES1_RCH), second address in the descriptor
+   * (buffer2) is the next descriptor address
+   */
+  for (i = 0U; i < eth_mac->num_rx_buf; ++i)
+  {
+	eth_mac->rx_desc[i].status = (uint32_t)ETH_MAC_DMA_RDES0_OWN;
+	eth_mac->rx_desc[i].length = (uint32_t)ETH_MAC_DMA_RDES1_RCH | (uint32_t)XMC_ETH_MAC_BUF_SIZE;
+    if (eth_mac->rx_watchdog != 0U)
+    {
+      /* Receive interrupt is raised by the watchdog */
+      eth_mac->rx_desc[i].length |= (uint32_t)ETH_MAC_DMA_RDES1_DIC;
+    }
+    if (keep_buffers == false)
+    {
+      eth_mac->rx_desc[i].buffer1 = (uint32_t)&(eth_mac->rx_buf[i * XMC_ETH_MAC_BUF_SIZE]);
+    }
+    next = i + 1U;
+    if (next == eth_mac->num_rx_buf)
+    {
+      next = 0U;
+    }
+    eth_mac->rx_desc[i].buffer2 = (uint32_t)&(eth_mac->rx_desc[next]);
+  }
+  eth_mac->regs->RECEIVE_DESCRIPTOR_LIST_ADDRESS = (uint32_t)&(eth_mac->rx_desc[0]);
+  eth_mac->rx_index = 0U;
+}
+
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+/* Account a receive call started at the given DWT cycle count */
+static void XMC_ETH_MAC_lRecordRxCycles(XMC_ETH_MAC_RX_CYCLES_t *const counters, const uint32_t start, const uint32_t frames)
+{
+  uint32_t cycles = DWT->CYCCNT - start;
+
+  if (frames > 0U)
+  {
+    counters->cycles += cycles;
+    counters->frames += frames;
+    counters->calls++;
+    if (cycles > counters->max_cycles)
+    {
+      counters->max_cycles = cycles;
+    }
+  }
+}
+#endif
+
+/* Lend the current RX frame and refill its descriptor from the pool, without resuming the DMA */
+static XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_lBorrowRxFrame(XMC_ETH_MAC_t *const eth_mac, XMC_ETH_MAC_RX_FRAME_t *const frame)
+{
+  XMC_ETH_MAC_DMA_DESC_t *rx_desc;
+  XMC_ETH_MAC_STATUS_t status;
+  uint32_t desc_status;
+
+  rx_desc = &eth_mac->rx_desc[eth_mac->rx_index];
+  desc_status = rx_desc->status;
+
+  if ((desc_status & ETH_MAC_DMA_RDES0_OWN) != 0U)
+  {
+    /* Owned by DMA, nothing received */
+    status = XMC_ETH_MAC_STATUS_BUSY;
+  }
+  else if (!XMC_ETH_MAC_lIsRxFrameValid(desc_status))
+  {
+    /* Error, drop the frame and keep the buffer in the descriptor */
+    XMC_ETH_MAC_lReturnRxDescriptor(eth_mac);
+    status = XMC_ETH_MAC_STATUS_ERROR;
+  }
+  else if (eth_mac->rx_pool_count == 0U)
+  {
+    /* No buffer to refill the descriptor, frame stays with the DMA ring */
+    status = XMC_ETH_MAC_STATUS_BUSY;
+  }
+  else
+  {
+    frame->buffer = (uint8_t *)rx_desc->buffer1;
+    frame->length = ((desc_status & ETH_MAC_DMA_RDES0_FL) >> 16U) - 4U;
+    frame->checksum_status = XMC_ETH_MAC_lGetRxChecksumStatus(rx_desc);
+    XMC_ETH_MAC_lCaptureRxTimeStamp(eth_mac, rx_desc, frame->buffer);
+
+    /* Swap in a free buffer so the descriptor can go back to DMA right away */
+    eth_mac->rx_pool_count--;
+    rx_desc->buffer1 = (uint32_t)eth_mac->rx_pool[eth_mac->rx_pool_count];
+
+    XMC_ETH_MAC_lReturnRxDescriptor(eth_mac);
+    status = XMC_ETH_MAC_STATUS_OK;
+  }
+
+  return status;
+}
+
+/* Driver owned buffer of a TX descriptor */
+__STATIC_INLINE uint32_t XMC_ETH_MAC_lGetTxBuffer(const XMC_ETH_MAC_t *const eth_mac, uint32_t index)
+{
+  return (uint32_t)&(eth_mac->tx_buf[index * XMC_ETH_MAC_BUF_SIZE]);
+}
+
+/* Check if a TX descriptor still points to caller memory of a zero-copy frame */
+__STATIC_INLINE bool XMC_ETH_MAC_lIsTxBufferLent(const XMC_ETH_MAC_t *const eth_mac, uint32_t index)
+{
+  return (eth_mac->tx_desc[index].buffer1 != XMC_ETH_MAC_lGetTxBuffer(eth_mac, index));
+}
+
+/* Account a descriptor handed to the DMA, until XMC_ETH_MAC_ProcessTxDone() reclaims it */
+__STATIC_INLINE void XMC_ETH_MAC_lQueueTxDescriptor(XMC_ETH_MAC_t *const eth_mac)
+{
+  if (eth_mac->tx_done_pending < eth_mac->num_tx_buf)
+  {
+    eth_mac->tx_done_pending++;
+  }
+  else
+  {
+    /* Copying path reused a descriptor that was never reclaimed, its completion is lost */
+    eth_mac->tx_done_index++;
+    if (eth_mac->tx_done_index == eth_mac->num_tx_buf)
+    {
+      eth_mac->tx_done_index = 0U;
+    }
+  }
+}
+
+/*
+ * Count a transmit event request and check if this frame has to raise the interrupt.
+ * first is the first descriptor of the frame, next the descriptor following its last one.
+ */
+__STATIC_INLINE bool XMC_ETH_MAC_lIsTxInterruptDue(XMC_ETH_MAC_t *const eth_mac, uint32_t first, uint32_t next)
+{
+  uint32_t prev;
+  bool due = true;
+
+  if (eth_mac->tx_coalesce_frames > 1U)
+  {
+    prev = ((first == 0U) ? (uint32_t)eth_mac->num_tx_buf : first) - 1U;
+
+    eth_mac->tx_coalesce_count++;
+    if ((eth_mac->tx_coalesce_count < eth_mac->tx_coalesce_frames) &&
+        ((eth_mac->tx_desc[prev].status & ETH_MAC_DMA_TDES0_OWN) != 0U) &&
+        ((eth_mac->tx_desc[next].status & ETH_MAC_DMA_TDES0_OWN) == 0U) &&
+        (XMC_ETH_MAC_lIsTxBufferLent(eth_mac, next) == false))
+    {
+      /* DMA still busy with earlier frames and room for the next one, defer the event */
+      due = false;
+    }
+    else
+    {
+      /*
+       * Count reached, DMA idle so the ring drains with this frame, or ring full so no
+       * further frame can be queued before a reclaim: raise the event
+       */
+      eth_mac->tx_coalesce_count = 0U;
+    }
+  }
+
+  return due;
+}
+
 #ifdef XMC_ASSERT_ENABLE 
  
 /* Check if the passed argument is a valid ETH module */ 
@@ -230,6 +570,11 @@ XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_Init(XMC_ETH_MAC_t *const eth_mac)
   /* Increase enhanced descriptor to 8 WORDS, required when the Advanced Time-Stamp feature or Full IPC Offload Engine is enabled */
   eth_mac->regs->BUS_MODE |= (uint32_t)ETH_BUS_MODE_ATDS_Msk;
 
+  /* Interrupt on every frame after reset */
+  eth_mac->rx_watchdog = 0U;
+  eth_mac->tx_coalesce_frames = 0U;
+  eth_mac->tx_coalesce_count = 0U;
+
   /* Initialize DMA Descriptors */
   XMC_ETH_MAC_InitRxDescriptors(eth_mac);
   XMC_ETH_MAC_InitTxDescriptors(eth_mac);
@@ -245,29 +590,9 @@ XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_Init(XMC_ETH_MAC_t *const eth_mac)
 /* Initialize RX descriptors */
 void XMC_ETH_MAC_InitRxDescriptors(XMC_ETH_MAC_t *const eth_mac)
 {
-  uint32_t i;
-  uint32_t next;
-
   XMC_ASSERT("XMC_ETH_MAC_InitRxDescriptors: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
 
-  /*
-   * Chained structure (ETH_MAC_DMA_RDES1_RCH), second address in the descriptor
-   * (buffer2) is the next descriptor address
-   */
-  for (i = 0U; i < eth_mac->num_rx_buf; ++i)
-  {
-	eth_mac->rx_desc[i].status = (uint32_t)ETH_MAC_DMA_RDES0_OWN;
-	eth_mac->rx_desc[i].length = (uint32_t)ETH_MAC_DMA_RDES1_RCH | (uint32_t)XMC_ETH_MAC_BUF_SIZE;
-	eth_mac->rx_desc[i].buffer1 = (uint32_t)&(eth_mac->rx_buf[i * XMC_ETH_MAC_BUF_SIZE]);
-    next = i + 1U;
-    if (next == eth_mac->num_rx_buf)
-    {
-      next = 0U;
-    }
-    eth_mac->rx_desc[i].buffer2 = (uint32_t)&(eth_mac->rx_desc[next]);
-  }
-  eth_mac->regs->RECEIVE_DESCRIPTOR_LIST_ADDRESS = (uint32_t)&(eth_mac->rx_desc[0]);
-  eth_mac->rx_index = 0U;
+  XMC_ETH_MAC_lInitRxDescriptors(eth_mac, false);
 }
 
 /* Initialize TX descriptors */
@@ -282,7 +607,8 @@ void XMC_ETH_MAC_InitTxDescriptors(XMC_ETH_MAC_t *const eth_mac)
   for (i = 0U; i < eth_mac->num_tx_buf; ++i)
   {
 	eth_mac->tx_desc[i].status = ETH_MAC_DMA_TDES0_TCH | ETH_MAC_DMA_TDES0_LS | ETH_MAC_DMA_TDES0_FS;
-	eth_mac->tx_desc[i].buffer1 = (uint32_t)&(eth_mac->tx_buf[i * XMC_ETH_MAC_BUF_SIZE]);
+	eth_mac->tx_desc[i].buffer1 = XMC_ETH_MAC_lGetTxBuffer(eth_mac, i);
+	eth_mac->tx_desc[i].reserved = 0U;
     next = i + 1U;
     if (next == eth_mac->num_tx_buf)
     {
@@ -292,6 +618,8 @@ void XMC_ETH_MAC_InitTxDescriptors(XMC_ETH_MAC_t *const eth_mac)
   }
   eth_mac->regs->TRANSMIT_DESCRIPTOR_LIST_ADDRESS = (uint32_t)&(eth_mac->tx_desc[0]);
   eth_mac->tx_index = 0U;
+  eth_mac->tx_done_index = 0U;
+  eth_mac->tx_done_pending = 0U;
 }
 
 /* Set address perfect filter */
@@ -305,9 +633,10 @@ void XMC_ETH_MAC_SetAddressPerfectFilter(XMC_ETH_MAC_t *const eth_mac,
   XMC_ASSERT("XMC_ETH_MAC_SetAddressPerfectFilter: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
   XMC_ASSERT("XMC_ETH_MAC_SetAddressFilter: index is out of range", ((index > 0) && (index < 4)));
 
+  /* Each slot is a HIGH/LOW register pair */
   reg = &(eth_mac->regs->MAC_ADDRESS0_HIGH);
-  reg[index] = (uint32_t)(addr >> 32U) | flags;
-  reg[index + 1U] = (uint32_t)addr;
+  reg[2U * index] = (uint32_t)(addr >> 32U) | flags | (uint32_t)ETH_MAC_ADDRESS1_HIGH_AE_Msk;
+  reg[(2U * index) + 1U] = (uint32_t)addr;
 }
 
 /* Set address hash filter */
@@ -317,92 +646,849 @@ void XMC_ETH_MAC_SetAddressHashFilter(XMC_ETH_MAC_t *const eth_mac, const uint64
   eth_mac->regs->HASH_TABLE_LOW = (uint32_t)hash;
 }
 
-/* Send frame */
-XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_SendFrame(XMC_ETH_MAC_t *const eth_mac, const uint8_t *frame, uint32_t len, uint32_t flags)
+/* Compute hash table bit of an address */
+uint32_t XMC_ETH_MAC_GetAddressHash(const uint64_t addr)
 {
-  XMC_ETH_MAC_STATUS_t status;
-  uint8_t *dst;
-  uint32_t ctrl;
-
-  XMC_ASSERT("XMC_ETH_MAC_SendFrame:", eth_mac != NULL);
-  XMC_ASSERT("XMC_ETH_MAC_SendFrame:", eth_mac->regs != ETH0);
-  XMC_ASSERT("XMC_ETH_MAC_SendFrame:", (frame != NULL) && (len > 0));
-
-  dst = eth_mac->frame_end;
+  uint32_t crc;
+  uint32_t hash;
+  uint32_t i;
+  uint32_t j;
 
-  if (eth_mac->tx_desc[eth_mac->tx_index].status & ETH_MAC_DMA_TDES0_OWN)
+  crc = 0xFFFFFFFFU;
+  for (i = 0U; i < 6U; ++i)
   {
-    /* Transmitter is busy, wait */
-    status = XMC_ETH_MAC_STATUS_BUSY;
-    if (eth_mac->regs->STATUS & ETH_STATUS_TU_Msk)
+    crc ^= (uint32_t)(addr >> (8U * i)) & 0xFFU;
+    for (j = 0U; j < 8U; ++j)
     {
-      /* Receive buffer unavailable, resume DMA */
-      eth_mac->regs->STATUS = (uint32_t)ETH_STATUS_TU_Msk;
-      eth_mac->regs->TRANSMIT_POLL_DEMAND = 0U;
+      crc = (crc >> 1U) ^ (XMC_ETH_MAC_CRC32_POLYNOMIAL & (0U - (crc & 1U)));
     }
+  }
+  crc = ~crc;
 
+  /* Upper six bits of the bit reversed CRC are the lower six bits in reverse order */
+  hash = 0U;
+  for (i = 0U; i < 6U; ++i)
+  {
+    hash = (hash << 1U) | ((crc >> i) & 1U);
+  }
+
+  return hash;
+}
+
+/* Write the hash table register holding the given bit */
+static void XMC_ETH_MAC_lWriteHashRegister(XMC_ETH_MAC_t *const eth_mac, uint32_t bit)
+{
+  const uint64_t hash = eth_mac->mc_filter->hash;
+
+  if (bit < 32U)
+  {
+    eth_mac->regs->HASH_TABLE_LOW = (uint32_t)hash;
   }
   else
   {
-    if (dst == NULL)
-    {
-      /* Start of a new transmit frame */
-      dst = (uint8_t *)eth_mac->tx_desc[eth_mac->tx_index].buffer1;
-      eth_mac->tx_desc[eth_mac->tx_index].length = len;
-    }
-    else
-    {
-      /* Sending data fragments in progress */
-      eth_mac->tx_desc[eth_mac->tx_index].length += len;
-    }
+    eth_mac->regs->HASH_TABLE_HIGH = (uint32_t)(hash >> 32U);
+  }
+}
 
-    memcpy(dst, frame, len);
+/* Add a group to the hash table, returns true if the table image changed */
+static bool XMC_ETH_MAC_lHashGroup(XMC_ETH_MAC_MULTICAST_FILTER_t *const filter,
+                                   const XMC_ETH_MAC_MULTICAST_GROUP_t *const group)
+{
+  bool changed;
 
-    if (flags & (uint32_t)XMC_ETH_MAC_TX_FRAME_FRAGMENT)
-    {
-      /* More data to come, remember current write position */
-      eth_mac->frame_end = dst;
-    }
-    else
-    {
-      /* Frame is now ready, send it to DMA */
-      ctrl = eth_mac->tx_desc[eth_mac->tx_index].status | ETH_MAC_DMA_TDES0_CIC;
-      ctrl &= ~(ETH_MAC_DMA_TDES0_IC | ETH_MAC_DMA_TDES0_TTSE);
+  changed = (filter->bins[group->hash] == 0U);
+  filter->bins[group->hash]++;
+  filter->hash |= (uint64_t)1U << group->hash;
 
-      if (flags & (uint32_t)XMC_ETH_MAC_TX_FRAME_EVENT)
-      {
-    	ctrl |= ETH_MAC_DMA_TDES0_IC;
-      }
+  return changed;
+}
 
-      if (flags & (uint32_t)XMC_ETH_MAC_TX_FRAME_TIMESTAMP)
-      {
-    	ctrl |= ETH_MAC_DMA_TDES0_TTSE;
-      }
-      eth_mac->tx_ts_index = eth_mac->tx_index;
+/* Remove a group from the hash table, returns true if the table image changed */
+static bool XMC_ETH_MAC_lUnhashGroup(XMC_ETH_MAC_MULTICAST_FILTER_t *const filter,
+                                     const XMC_ETH_MAC_MULTICAST_GROUP_t *const group)
+{
+  bool changed;
 
-      eth_mac->tx_desc[eth_mac->tx_index].status = ctrl | ETH_MAC_DMA_TDES0_OWN;
+  filter->bins[group->hash]--;
+  changed = (filter->bins[group->hash] == 0U);
+  if (changed)
+  {
+    filter->hash &= ~((uint64_t)1U << group->hash);
+  }
 
-      eth_mac->tx_index++;
-      if (eth_mac->tx_index == eth_mac->num_tx_buf)
-      {
-    	eth_mac->tx_index = 0U;
+  return changed;
+}
+
+/* Program or disable a perfect filter slot */
+static void XMC_ETH_MAC_lWriteSlot(XMC_ETH_MAC_t *const eth_mac, uint32_t slot, const XMC_ETH_MAC_MULTICAST_GROUP_t *const group)
+{
+  __IO uint32_t *reg;
+
+  if (group != NULL)
+  {
+    XMC_ETH_MAC_SetAddressPerfectFilter(eth_mac, (uint8_t)slot, group->addr, 0U);
+  }
+  else
+  {
+    reg = &(eth_mac->regs->MAC_ADDRESS0_HIGH);
+    reg[2U * slot] = 0U;
+  }
+}
+
+/* Find the hashed group with the highest frame count */
+static XMC_ETH_MAC_MULTICAST_GROUP_t *XMC_ETH_MAC_lFindBusiestHashedGroup(const XMC_ETH_MAC_MULTICAST_FILTER_t *const filter)
+{
+  XMC_ETH_MAC_MULTICAST_GROUP_t *busiest;
+  uint32_t i;
+
+  busiest = NULL;
+  for (i = 0U; i < filter->count; ++i)
+  {
+    if ((filter->groups[i].slot == 0U) &&
+        ((busiest == NULL) || (filter->groups[i].frames > busiest->frames)))
+    {
+      busiest = &filter->groups[i];
+    }
+  }
+
+  return busiest;
+}
+
+/* Initialize multicast filter manager */
+void XMC_ETH_MAC_InitMulticastFilter(XMC_ETH_MAC_t *const eth_mac,
+                                     XMC_ETH_MAC_MULTICAST_FILTER_t *const filter,
+                                     XMC_ETH_MAC_MULTICAST_GROUP_t *const groups,
+                                     uint16_t size,
+                                     uint8_t first_slot)
+{
+  uint32_t i;
+
+  XMC_ASSERT("XMC_ETH_MAC_InitMulticastFilter: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_InitMulticastFilter: group table is invalid", (groups != NULL) && (size > 0U));
+  XMC_ASSERT("XMC_ETH_MAC_InitMulticastFilter: first_slot is out of range",
+             (first_slot > 0U) && (first_slot <= XMC_ETH_MAC_PERFECT_FILTER_SLOTS));
+
+  filter->groups = groups;
+  filter->size = size;
+  filter->count = 0U;
+  filter->first_slot = first_slot;
+  filter->hash = 0U;
+  for (i = 0U; i < XMC_ETH_MAC_HASH_TABLE_SIZE; ++i)
+  {
+    filter->bins[i] = 0U;
+  }
+
+  eth_mac->mc_filter = filter;
+
+  for (i = first_slot; i < XMC_ETH_MAC_PERFECT_FILTER_SLOTS; ++i)
+  {
+    XMC_ETH_MAC_lWriteSlot(eth_mac, i, NULL);
+  }
+  XMC_ETH_MAC_SetAddressHashFilter(eth_mac, 0U);
+
+  XMC_ETH_MAC_EnableMulticastHashFilter(eth_mac);
+  XMC_ETH_MAC_EnableHashPerfectFilter(eth_mac);
+}
+
+/* Find joined multicast group */
+XMC_ETH_MAC_MULTICAST_GROUP_t *XMC_ETH_MAC_FindMulticastGroup(XMC_ETH_MAC_t *const eth_mac, const uint64_t addr)
+{
+  XMC_ETH_MAC_MULTICAST_FILTER_t *filter;
+  XMC_ETH_MAC_MULTICAST_GROUP_t *group;
+  uint32_t i;
+
+  XMC_ASSERT("XMC_ETH_MAC_FindMulticastGroup: multicast filter not initialized", eth_mac->mc_filter != NULL);
+
+  filter = eth_mac->mc_filter;
+  group = NULL;
+  for (i = 0U; (i < filter->count) && (group == NULL); ++i)
+  {
+    if (filter->groups[i].addr == addr)
+    {
+      group = &filter->groups[i];
+    }
+  }
+
+  return group;
+}
+
+/* Add a group to the table and program a perfect filter slot or its hash bit */
+static void XMC_ETH_MAC_lAddMulticastGroup(XMC_ETH_MAC_t *const eth_mac,
+                                           XMC_ETH_MAC_MULTICAST_FILTER_t *const filter,
+                                           const uint64_t addr)
+{
+  XMC_ETH_MAC_MULTICAST_GROUP_t *group;
+  bool used[XMC_ETH_MAC_PERFECT_FILTER_SLOTS] = {false};
+  uint32_t slot;
+  uint32_t i;
+
+  group = &filter->groups[filter->count];
+  group->addr = addr;
+  group->frames = 0U;
+  group->users = 1U;
+  group->hash = (uint8_t)XMC_ETH_MAC_GetAddressHash(addr);
+  group->slot = 0U;
+  filter->count++;
+
+  /* Take a free perfect filter slot */
+  for (i = 0U; i < (uint32_t)filter->count - 1U; ++i)
+  {
+    used[filter->groups[i].slot] = true;
+  }
+  for (slot = filter->first_slot; (slot < XMC_ETH_MAC_PERFECT_FILTER_SLOTS) && used[slot]; ++slot)
+  {
+    /* Skip used slots */
+  }
+
+  if (slot < XMC_ETH_MAC_PERFECT_FILTER_SLOTS)
+  {
+    group->slot = (uint8_t)slot;
+    XMC_ETH_MAC_lWriteSlot(eth_mac, slot, group);
+  }
+  else if (XMC_ETH_MAC_lHashGroup(filter, group))
+  {
+    XMC_ETH_MAC_lWriteHashRegister(eth_mac, group->hash);
+  }
+  else
+  {
+    /* Hash table bit already set by another group */
+  }
+}
+
+/* Remove a group without users from the table and release its filter resources */
+static void XMC_ETH_MAC_lRemoveMulticastGroup(XMC_ETH_MAC_t *const eth_mac,
+                                              XMC_ETH_MAC_MULTICAST_FILTER_t *const filter,
+                                              XMC_ETH_MAC_MULTICAST_GROUP_t *group)
+{
+  XMC_ETH_MAC_MULTICAST_GROUP_t *last;
+  uint32_t slot;
+
+  slot = group->slot;
+  if (slot == 0U)
+  {
+    if (XMC_ETH_MAC_lUnhashGroup(filter, group))
+    {
+      XMC_ETH_MAC_lWriteHashRegister(eth_mac, group->hash);
+    }
+  }
+
+  /* Keep the group table packed */
+  filter->count--;
+  last = &filter->groups[filter->count];
+  if (group != last)
+  {
+    *group = *last;
+  }
+
+  if (slot != 0U)
+  {
+    /* Promote the busiest hashed group into the freed slot, the slot is rewritten before the hash bit is dropped */
+    group = XMC_ETH_MAC_lFindBusiestHashedGroup(filter);
+    XMC_ETH_MAC_lWriteSlot(eth_mac, slot, group);
+    if (group != NULL)
+    {
+      group->slot = (uint8_t)slot;
+      if (XMC_ETH_MAC_lUnhashGroup(filter, group))
+      {
+        XMC_ETH_MAC_lWriteHashRegister(eth_mac, group->hash);
+      }
+    }
+  }
+}
+
+/* Join multicast group */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_JoinMulticastGroup(XMC_ETH_MAC_t *const eth_mac, const uint64_t addr)
+{
+  XMC_ETH_MAC_MULTICAST_FILTER_t *filter;
+  XMC_ETH_MAC_MULTICAST_GROUP_t *group;
+  XMC_ETH_MAC_STATUS_t status;
+
+  XMC_ASSERT("XMC_ETH_MAC_JoinMulticastGroup: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_JoinMulticastGroup: multicast filter not initialized", eth_mac->mc_filter != NULL);
+
+  filter = eth_mac->mc_filter;
+  group = XMC_ETH_MAC_FindMulticastGroup(eth_mac, addr);
+  if (group != NULL)
+  {
+    /* Already joined, count the user */
+    group->users++;
+    status = XMC_ETH_MAC_STATUS_OK;
+  }
+  else if (filter->count == filter->size)
+  {
+    /* Group table is full */
+    status = XMC_ETH_MAC_STATUS_ERROR;
+  }
+  else
+  {
+    XMC_ETH_MAC_lAddMulticastGroup(eth_mac, filter, addr);
+    status = XMC_ETH_MAC_STATUS_OK;
+  }
+
+  return status;
+}
+
+/* Leave multicast group */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_LeaveMulticastGroup(XMC_ETH_MAC_t *const eth_mac, const uint64_t addr)
+{
+  XMC_ETH_MAC_MULTICAST_GROUP_t *group;
+  XMC_ETH_MAC_STATUS_t status;
+
+  XMC_ASSERT("XMC_ETH_MAC_LeaveMulticastGroup: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_LeaveMulticastGroup: multicast filter not initialized", eth_mac->mc_filter != NULL);
+
+  group = XMC_ETH_MAC_FindMulticastGroup(eth_mac, addr);
+  if (group == NULL)
+  {
+    /* Not joined */
+    status = XMC_ETH_MAC_STATUS_ERROR;
+  }
+  else
+  {
+    group->users--;
+    if (group->users == 0U)
+    {
+      XMC_ETH_MAC_lRemoveMulticastGroup(eth_mac, eth_mac->mc_filter, group);
+    }
+    status = XMC_ETH_MAC_STATUS_OK;
+  }
+
+  return status;
+}
+
+/* Give perfect filter slots to the busiest groups */
+void XMC_ETH_MAC_RebalanceMulticastFilter(XMC_ETH_MAC_t *const eth_mac)
+{
+  XMC_ETH_MAC_MULTICAST_FILTER_t *filter;
+  XMC_ETH_MAC_MULTICAST_GROUP_t *chosen[XMC_ETH_MAC_PERFECT_FILTER_SLOTS] = {NULL};
+  XMC_ETH_MAC_MULTICAST_GROUP_t *group;
+  uint32_t slot;
+  uint32_t i;
+  uint32_t j;
+  bool changed;
+
+  XMC_ASSERT("XMC_ETH_MAC_RebalanceMulticastFilter: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_RebalanceMulticastFilter: multicast filter not initialized", eth_mac->mc_filter != NULL);
+
+  filter = eth_mac->mc_filter;
+
+  /* Select the busiest groups, sorted by descending frame count; ties keep the current slot holder */
+  for (i = 0U; i < filter->count; ++i)
+  {
+    group = &filter->groups[i];
+    for (slot = filter->first_slot; slot < XMC_ETH_MAC_PERFECT_FILTER_SLOTS; ++slot)
+    {
+      if ((chosen[slot] == NULL) ||
+          (group->frames > chosen[slot]->frames) ||
+          ((group->frames == chosen[slot]->frames) && (group->slot != 0U) && (chosen[slot]->slot == 0U)))
+      {
+        for (j = XMC_ETH_MAC_PERFECT_FILTER_SLOTS - 1U; j > slot; --j)
+        {
+          chosen[j] = chosen[j - 1U];
+        }
+        chosen[slot] = group;
+        break;
+      }
+    }
+  }
+
+  /* Chosen groups keep the slot they already hold, every swap settles one group */
+  slot = filter->first_slot;
+  while (slot < XMC_ETH_MAC_PERFECT_FILTER_SLOTS)
+  {
+    group = chosen[slot];
+    if ((group != NULL) && (group->slot != 0U) && (group->slot != slot))
+    {
+      chosen[slot] = chosen[group->slot];
+      chosen[group->slot] = group;
+    }
+    else
+    {
+      ++slot;
+    }
+  }
+
+  /* Demoted groups go to the hash table first */
+  changed = false;
+  for (i = 0U; i < filter->count; ++i)
+  {
+    group = &filter->groups[i];
+    if ((group->slot != 0U) && (chosen[group->slot] != group))
+    {
+      group->slot = 0U;
+      changed |= XMC_ETH_MAC_lHashGroup(filter, group);
+    }
+  }
+  if (changed)
+  {
+    XMC_ETH_MAC_SetAddressHashFilter(eth_mac, filter->hash);
+  }
+
+  /* Program promoted groups, then drop them from the hash table */
+  changed = false;
+  for (slot = filter->first_slot; slot < XMC_ETH_MAC_PERFECT_FILTER_SLOTS; ++slot)
+  {
+    group = chosen[slot];
+    if ((group != NULL) && (group->slot == 0U))
+    {
+      XMC_ETH_MAC_lWriteSlot(eth_mac, slot, group);
+      group->slot = (uint8_t)slot;
+      changed |= XMC_ETH_MAC_lUnhashGroup(filter, group);
+    }
+  }
+  if (changed)
+  {
+    XMC_ETH_MAC_SetAddressHashFilter(eth_mac, filter->hash);
+  }
+
+  /* Age the frame counts */
+  for (i = 0U; i < filter->count; ++i)
+  {
+    filter->groups[i].frames >>= 1U;
+  }
+}
+
+/* Accumulate a block of consecutive MAC management counters */
+static void XMC_ETH_MAC_lUpdateMmcBlock(XMC_ETH_MAC_STATISTICS_t *const stats,
+                                        const volatile uint32_t *reg,
+                                        uint32_t first,
+                                        uint32_t last)
+{
+  uint32_t value;
+  uint32_t delta;
+  uint32_t i;
+
+  for (i = first; i <= last; ++i)
+  {
+    value = *reg;
+    ++reg;
+
+    /* Unsigned difference is exact across a single counter wrap */
+    delta = value - stats->mmc_last[i];
+    stats->mmc_last[i] = value;
+    stats->interval.mmc[i] = delta;
+    stats->total.mmc[i] += delta;
+  }
+}
+
+/* Read the DMA missed frame counters, they are cleared on read and saturate */
+static void XMC_ETH_MAC_lUpdateMissedFrames(XMC_ETH_MAC_t *const eth_mac)
+{
+  XMC_ETH_MAC_STATISTICS_t *const stats = eth_mac->stats;
+  uint32_t value;
+  uint32_t missed;
+  uint32_t overflow;
+
+  value = eth_mac->regs->MISSED_FRAME_AND_BUFFER_OVERFLOW_COUNTER;
+
+  if ((value & ETH_MISSED_FRAME_AND_BUFFER_OVERFLOW_COUNTER_MISCNTOVF_Msk) != 0U)
+  {
+    missed = ETH_MISSED_FRAME_AND_BUFFER_OVERFLOW_COUNTER_MISFRMCNT_Msk >> ETH_MISSED_FRAME_AND_BUFFER_OVERFLOW_COUNTER_MISFRMCNT_Pos;
+  }
+  else
+  {
+    missed = (value & ETH_MISSED_FRAME_AND_BUFFER_OVERFLOW_COUNTER_MISFRMCNT_Msk) >> ETH_MISSED_FRAME_AND_BUFFER_OVERFLOW_COUNTER_MISFRMCNT_Pos;
+  }
+
+  if ((value & ETH_MISSED_FRAME_AND_BUFFER_OVERFLOW_COUNTER_OVFCNTOVF_Msk) != 0U)
+  {
+    overflow = ETH_MISSED_FRAME_AND_BUFFER_OVERFLOW_COUNTER_OVFFRMCNT_Msk >> ETH_MISSED_FRAME_AND_BUFFER_OVERFLOW_COUNTER_OVFFRMCNT_Pos;
+  }
+  else
+  {
+    overflow = (value & ETH_MISSED_FRAME_AND_BUFFER_OVERFLOW_COUNTER_OVFFRMCNT_Msk) >> ETH_MISSED_FRAME_AND_BUFFER_OVERFLOW_COUNTER_OVFFRMCNT_Pos;
+  }
+
+  stats->interval.rx_missed_frames = missed;
+  stats->total.rx_missed_frames += missed;
+  stats->interval.rx_overflow_frames = overflow;
+  stats->total.rx_overflow_frames += overflow;
+}
+
+/* Clear a statistics counter set */
+static void XMC_ETH_MAC_lClearCounters(XMC_ETH_MAC_COUNTERS_t *const counters)
+{
+  uint32_t i;
+
+  for (i = 0U; i < (uint32_t)XMC_ETH_MAC_MMC_COUNTER_NUM; ++i)
+  {
+    counters->mmc[i] = 0U;
+  }
+  counters->rx_missed_frames = 0U;
+  counters->rx_overflow_frames = 0U;
+  counters->tx_busy = 0U;
+}
+
+/* Initialize statistics */
+void XMC_ETH_MAC_InitStatistics(XMC_ETH_MAC_t *const eth_mac, XMC_ETH_MAC_STATISTICS_t *const stats)
+{
+  uint32_t i;
+
+  XMC_ASSERT("XMC_ETH_MAC_InitStatistics: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_InitStatistics: stats is invalid", stats != NULL);
+
+  /* Free running counters, polled instead of interrupt driven */
+  eth_mac->regs->MMC_CONTROL &= (uint32_t)~(ETH_MMC_CONTROL_CNTSTOPRO_Msk |
+                                            ETH_MMC_CONTROL_RSTONRD_Msk |
+                                            ETH_MMC_CONTROL_CNTFREEZ_Msk);
+  eth_mac->regs->MMC_RECEIVE_INTERRUPT_MASK = 0xFFFFFFFFU;
+  eth_mac->regs->MMC_TRANSMIT_INTERRUPT_MASK = 0xFFFFFFFFU;
+  eth_mac->regs->MMC_IPC_RECEIVE_INTERRUPT_MASK = 0xFFFFFFFFU;
+
+  for (i = 0U; i < (uint32_t)XMC_ETH_MAC_MMC_COUNTER_NUM; ++i)
+  {
+    stats->mmc_last[i] = 0U;
+  }
+  stats->tx_busy = 0U;
+  stats->tx_busy_last = 0U;
+
+  eth_mac->stats = stats;
+
+  /* Take the current counts as baseline */
+  XMC_ETH_MAC_UpdateStatistics(eth_mac);
+
+  XMC_ETH_MAC_lClearCounters(&stats->total);
+  XMC_ETH_MAC_lClearCounters(&stats->interval);
+}
+
+/* Snapshot statistics counters */
+void XMC_ETH_MAC_UpdateStatistics(XMC_ETH_MAC_t *const eth_mac)
+{
+  XMC_ETH_MAC_STATISTICS_t *stats;
+  uint32_t tx_busy;
+
+  XMC_ASSERT("XMC_ETH_MAC_UpdateStatistics: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_UpdateStatistics: statistics not initialized", eth_mac->stats != NULL);
+
+  stats = eth_mac->stats;
+
+  XMC_ETH_MAC_lUpdateMmcBlock(stats, &eth_mac->regs->TX_OCTET_COUNT_GOOD_BAD,
+                              (uint32_t)XMC_ETH_MAC_MMC_COUNTER_TX_OCTETS_GOOD_BAD,
+                              (uint32_t)XMC_ETH_MAC_MMC_COUNTER_TX_OVERSIZE_FRAMES_GOOD);
+  XMC_ETH_MAC_lUpdateMmcBlock(stats, &eth_mac->regs->RX_FRAMES_COUNT_GOOD_BAD,
+                              (uint32_t)XMC_ETH_MAC_MMC_COUNTER_RX_FRAMES_GOOD_BAD,
+                              (uint32_t)XMC_ETH_MAC_MMC_COUNTER_RX_CONTROL_FRAMES_GOOD);
+  XMC_ETH_MAC_lUpdateMmcBlock(stats, &eth_mac->regs->RXIPV4_GOOD_FRAMES,
+                              (uint32_t)XMC_ETH_MAC_MMC_COUNTER_RX_IPV4_GOOD_FRAMES,
+                              (uint32_t)XMC_ETH_MAC_MMC_COUNTER_RX_ICMP_ERROR_FRAMES);
+  XMC_ETH_MAC_lUpdateMmcBlock(stats, &eth_mac->regs->RXIPV4_GOOD_OCTETS,
+                              (uint32_t)XMC_ETH_MAC_MMC_COUNTER_RX_IPV4_GOOD_OCTETS,
+                              (uint32_t)XMC_ETH_MAC_MMC_COUNTER_RX_ICMP_ERROR_OCTETS);
+
+  XMC_ETH_MAC_lUpdateMissedFrames(eth_mac);
+
+  tx_busy = stats->tx_busy;
+  stats->interval.tx_busy = tx_busy - stats->tx_busy_last;
+  stats->total.tx_busy += stats->interval.tx_busy;
+  stats->tx_busy_last = tx_busy;
+}
+
+/* Send frame */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_SendFrame(XMC_ETH_MAC_t *const eth_mac, const uint8_t *frame, uint32_t len, uint32_t flags)
+{
+  XMC_ETH_MAC_STATUS_t status;
+  uint8_t *dst;
+  uint32_t ctrl;
+  uint32_t next;
+
+  XMC_ASSERT("XMC_ETH_MAC_SendFrame:", eth_mac != NULL);
+  XMC_ASSERT("XMC_ETH_MAC_SendFrame:", eth_mac->regs != ETH0);
+  XMC_ASSERT("XMC_ETH_MAC_SendFrame:", (frame != NULL) && (len > 0));
+
+  dst = eth_mac->frame_end;
+
+  if ((eth_mac->tx_desc[eth_mac->tx_index].status & ETH_MAC_DMA_TDES0_OWN) ||
+      XMC_ETH_MAC_lIsTxBufferLent(eth_mac, eth_mac->tx_index))
+  {
+    /* Transmitter is busy or zero-copy frame not yet reclaimed, wait */
+    status = XMC_ETH_MAC_STATUS_BUSY;
+    if (eth_mac->stats != NULL)
+    {
+      eth_mac->stats->tx_busy++;
+    }
+    if (eth_mac->regs->STATUS & ETH_STATUS_TU_Msk)
+    {
+      /* Receive buffer unavailable, resume DMA */
+      eth_mac->regs->STATUS = (uint32_t)ETH_STATUS_TU_Msk;
+      eth_mac->regs->TRANSMIT_POLL_DEMAND = 0U;
+    }
+
+  }
+  else
+  {
+    if (dst == NULL)
+    {
+      /* Start of a new transmit frame */
+      dst = (uint8_t *)eth_mac->tx_desc[eth_mac->tx_index].buffer1;
+      eth_mac->tx_desc[eth_mac->tx_index].length = len;
+    }
+    else
+    {
+      /* Sending data fragments in progress */
+      eth_mac->tx_desc[eth_mac->tx_index].length += len;
+    }
+
+    memcpy(dst, frame, len);
+
+    if (flags & (uint32_t)XMC_ETH_MAC_TX_FRAME_FRAGMENT)
+    {
+      /* More data to come, remember current write position */
+      eth_mac->frame_end = dst;
+    }
+    else
+    {
+      /* Frame is now ready, send it to DMA */
+      ctrl = eth_mac->tx_desc[eth_mac->tx_index].status;
+      ctrl &= ~(ETH_MAC_DMA_TDES0_IC | ETH_MAC_DMA_TDES0_TTSE | ETH_MAC_DMA_TDES0_CIC);
+      ctrl |= XMC_ETH_MAC_lGetTxChecksumControl(flags);
+
+      next = (uint32_t)eth_mac->tx_index + 1U;
+      if (next == eth_mac->num_tx_buf)
+      {
+        next = 0U;
+      }
+
+      if ((flags & (uint32_t)XMC_ETH_MAC_TX_FRAME_EVENT) &&
+          XMC_ETH_MAC_lIsTxInterruptDue(eth_mac, eth_mac->tx_index, next))
+      {
+    	ctrl |= ETH_MAC_DMA_TDES0_IC;
+      }
+
+      if (flags & (uint32_t)XMC_ETH_MAC_TX_FRAME_TIMESTAMP)
+      {
+    	ctrl |= ETH_MAC_DMA_TDES0_TTSE;
+      }
+      eth_mac->tx_ts_index = eth_mac->tx_index;
+
+      /* Tag for the time stamp ring */
+      eth_mac->tx_desc[eth_mac->tx_index].reserved = (uint32_t)frame;
+
+      eth_mac->tx_desc[eth_mac->tx_index].status = ctrl | ETH_MAC_DMA_TDES0_OWN;
+      XMC_ETH_MAC_lQueueTxDescriptor(eth_mac);
+
+      eth_mac->tx_index++;
+      if (eth_mac->tx_index == eth_mac->num_tx_buf)
+      {
+    	eth_mac->tx_index = 0U;
       }
       eth_mac->frame_end = NULL;
 
-      /* Start frame transmission */
-      eth_mac->regs->STATUS = (uint32_t)ETH_STATUS_TPS_Msk;
+      /* Start frame transmission */
+      eth_mac->regs->STATUS = (uint32_t)ETH_STATUS_TPS_Msk;
+      eth_mac->regs->TRANSMIT_POLL_DEMAND = 0U;
+    }
+    status = XMC_ETH_MAC_STATUS_OK;
+  }
+
+  return status;
+}
+
+/* Send frame from scattered buffers */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_SendFrameScatter(XMC_ETH_MAC_t *const eth_mac,
+                                                  const XMC_ETH_MAC_TX_FRAGMENT_t *const fragments,
+                                                  uint32_t num,
+                                                  uint32_t flags,
+                                                  void *const context)
+{
+  XMC_ETH_MAC_STATUS_t status;
+  uint32_t first_ctrl;
+  uint32_t ctrl;
+  uint32_t index;
+  uint32_t next;
+  uint32_t i;
+
+  XMC_ASSERT("XMC_ETH_MAC_SendFrameScatter: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_SendFrameScatter: fragments are invalid", fragments != NULL);
+  XMC_ASSERT("XMC_ETH_MAC_SendFrameScatter: fragmented frame in progress", eth_mac->frame_end == NULL);
+  XMC_ASSERT("XMC_ETH_MAC_SendFrameScatter: fragment flag not supported", (flags & (uint32_t)XMC_ETH_MAC_TX_FRAME_FRAGMENT) == 0U);
+
+  /*
+   * Every fragment must fit the buffer 1 size field, and all descriptors of the frame must be free.
+   * More fragments than descriptors would wrap onto the first descriptors of the same frame.
+   */
+  status = ((num == 0U) || (num > eth_mac->num_tx_buf)) ? XMC_ETH_MAC_STATUS_ERROR : XMC_ETH_MAC_STATUS_OK;
+  index = eth_mac->tx_index;
+  for (i = 0U; (status == XMC_ETH_MAC_STATUS_OK) && (i < num); ++i)
+  {
+    if ((fragments[i].length == 0U) || (fragments[i].length > ETH_MAC_DMA_TDES1_TBS1))
+    {
+      status = XMC_ETH_MAC_STATUS_ERROR;
+      break;
+    }
+
+    if (((eth_mac->tx_desc[index].status & ETH_MAC_DMA_TDES0_OWN) != 0U) ||
+        XMC_ETH_MAC_lIsTxBufferLent(eth_mac, index))
+    {
+      status = XMC_ETH_MAC_STATUS_BUSY;
+      break;
+    }
+
+    index++;
+    if (index == eth_mac->num_tx_buf)
+    {
+      index = 0U;
+    }
+  }
+
+  if (status == XMC_ETH_MAC_STATUS_BUSY)
+  {
+    if (eth_mac->stats != NULL)
+    {
+      eth_mac->stats->tx_busy++;
+    }
+
+    if (eth_mac->regs->STATUS & ETH_STATUS_TU_Msk)
+    {
+      /* Transmit buffer unavailable, resume DMA */
+      eth_mac->regs->STATUS = (uint32_t)ETH_STATUS_TU_Msk;
       eth_mac->regs->TRANSMIT_POLL_DEMAND = 0U;
     }
-    status = XMC_ETH_MAC_STATUS_OK;
+  }
+  else if (status == XMC_ETH_MAC_STATUS_ERROR)
+  {
+    /* Invalid fragment count or length, nothing queued */
+  }
+  else
+  {
+    first_ctrl = 0U;
+    index = eth_mac->tx_index;
+    for (i = 0U; i < num; ++i)
+    {
+      XMC_ASSERT("XMC_ETH_MAC_SendFrameScatter: fragment is invalid",
+                 (fragments[i].buffer != NULL) && (fragments[i].length > 0U));
+
+      ctrl = ETH_MAC_DMA_TDES0_TCH | XMC_ETH_MAC_lGetTxChecksumControl(flags);
+      eth_mac->tx_desc[index].buffer1 = (uint32_t)fragments[i].buffer;
+      eth_mac->tx_desc[index].length = fragments[i].length;
+      eth_mac->tx_desc[index].reserved = 0U;
+
+      if (i == 0U)
+      {
+        ctrl |= ETH_MAC_DMA_TDES0_FS;
+        if (flags & (uint32_t)XMC_ETH_MAC_TX_FRAME_TIMESTAMP)
+        {
+          ctrl |= ETH_MAC_DMA_TDES0_TTSE;
+        }
+      }
+
+      if (i == (num - 1U))
+      {
+        ctrl |= ETH_MAC_DMA_TDES0_LS;
+        next = index + 1U;
+        if (next == eth_mac->num_tx_buf)
+        {
+          next = 0U;
+        }
+
+        if ((flags & (uint32_t)XMC_ETH_MAC_TX_FRAME_EVENT) &&
+            XMC_ETH_MAC_lIsTxInterruptDue(eth_mac, eth_mac->tx_index, next))
+        {
+          ctrl |= ETH_MAC_DMA_TDES0_IC;
+        }
+        eth_mac->tx_desc[index].reserved = (uint32_t)context;
+
+        /* Time stamp is written back to the last descriptor of the frame */
+        eth_mac->tx_ts_index = (uint8_t)index;
+      }
+
+      if (i == 0U)
+      {
+        first_ctrl = ctrl;
+      }
+      else
+      {
+        eth_mac->tx_desc[index].status = ctrl | ETH_MAC_DMA_TDES0_OWN;
+      }
+      XMC_ETH_MAC_lQueueTxDescriptor(eth_mac);
+
+      index++;
+      if (index == eth_mac->num_tx_buf)
+      {
+        index = 0U;
+      }
+    }
+
+    /* Hand the first descriptor over last, so the DMA sees a complete chain */
+    eth_mac->tx_desc[eth_mac->tx_index].status = first_ctrl | ETH_MAC_DMA_TDES0_OWN;
+    eth_mac->tx_index = (uint8_t)index;
+
+    /* Start frame transmission */
+    eth_mac->regs->STATUS = (uint32_t)ETH_STATUS_TPS_Msk;
+    eth_mac->regs->TRANSMIT_POLL_DEMAND = 0U;
   }
 
   return status;
 }
 
+/* Reclaim completed zero-copy transmit descriptors */
+uint32_t XMC_ETH_MAC_ProcessTxDone(XMC_ETH_MAC_t *const eth_mac)
+{
+  XMC_ETH_MAC_DMA_DESC_t *tx_desc;
+  uint32_t index;
+  uint32_t count;
+
+  XMC_ASSERT("XMC_ETH_MAC_ProcessTxDone: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+
+  /*
+   * Walk the queued descriptors by count, not by comparing with tx_index: with a full
+   * ring both indices are equal although every descriptor waits to be reclaimed
+   */
+  count = 0U;
+  index = eth_mac->tx_done_index;
+  while (eth_mac->tx_done_pending > 0U)
+  {
+    tx_desc = &eth_mac->tx_desc[index];
+    if ((tx_desc->status & ETH_MAC_DMA_TDES0_OWN) != 0U)
+    {
+      /* Still owned by DMA */
+      break;
+    }
+
+    if (XMC_ETH_MAC_lIsTxBufferLent(eth_mac, index))
+    {
+      if ((tx_desc->status & ETH_MAC_DMA_TDES0_LS) != 0U)
+      {
+        /* Last descriptor of the frame, the fragment memory is released */
+        XMC_ETH_MAC_lCaptureTxTimeStamp(eth_mac, tx_desc);
+        if (eth_mac->tx_done_handler != NULL)
+        {
+          eth_mac->tx_done_handler((void *)tx_desc->reserved);
+        }
+        count++;
+      }
+
+      /* Restore the descriptor for the copying transmit path */
+      tx_desc->buffer1 = XMC_ETH_MAC_lGetTxBuffer(eth_mac, index);
+      tx_desc->reserved = 0U;
+      tx_desc->status = ETH_MAC_DMA_TDES0_TCH | ETH_MAC_DMA_TDES0_LS | ETH_MAC_DMA_TDES0_FS;
+    }
+    else
+    {
+      /* Frame sent from driver buffer, nothing to release */
+      XMC_ETH_MAC_lCaptureTxTimeStamp(eth_mac, tx_desc);
+      tx_desc->status &= ~ETH_MAC_DMA_TDES0_TTSS;
+    }
+    eth_mac->tx_done_pending--;
+
+    index++;
+    if (index == eth_mac->num_tx_buf)
+    {
+      index = 0U;
+    }
+  }
+
+  eth_mac->tx_done_index = (uint8_t)index;
+
+  return count;
+}
+
 /* Read frame */
 uint32_t XMC_ETH_MAC_ReadFrame(XMC_ETH_MAC_t *const eth_mac, uint8_t *frame, uint32_t len)
 {
   uint8_t const *src;
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+  uint32_t start = DWT->CYCCNT;
+#endif
 
   XMC_ASSERT("XMC_ETH_MAC_ReadFrame:", eth_mac != NULL);
   XMC_ASSERT("XMC_ETH_MAC_ReadFrame:", eth_mac->regs != ETH0);
@@ -413,24 +1499,186 @@ uint32_t XMC_ETH_MAC_ReadFrame(XMC_ETH_MAC_t *const eth_mac, uint8_t *frame, uin
 
   memcpy(frame, src, len);
 
+  XMC_ETH_MAC_lCaptureRxTimeStamp(eth_mac, &eth_mac->rx_desc[eth_mac->rx_index], frame);
+
   /* Return this block back to DMA */
-  eth_mac->rx_desc[eth_mac->rx_index].status = ETH_MAC_DMA_RDES0_OWN;
+  XMC_ETH_MAC_lReturnRxDescriptor(eth_mac);
+  XMC_ETH_MAC_lResumeRx(eth_mac);
 
-  eth_mac->rx_index++;
-  if (eth_mac->rx_index == eth_mac->num_rx_buf)
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+  XMC_ETH_MAC_lRecordRxCycles(&eth_mac->rx_cycles_single, start, 1U);
+#endif
+
+  return (len);
+}
+
+/* Initialize RX buffer pool */
+void XMC_ETH_MAC_InitRxBufferPool(XMC_ETH_MAC_t *const eth_mac, uint8_t **const pool, uint8_t *const buffers, uint8_t num)
+{
+  uint32_t i;
+
+  XMC_ASSERT("XMC_ETH_MAC_InitRxBufferPool: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_InitRxBufferPool: pool is invalid", (pool != NULL) && (buffers != NULL));
+
+  for (i = 0U; i < num; ++i)
   {
-    eth_mac->rx_index = 0U;
+    pool[i] = &buffers[i * XMC_ETH_MAC_BUF_SIZE];
   }
 
-  if (eth_mac->regs->STATUS & ETH_STATUS_RU_Msk)
+  eth_mac->rx_pool = pool;
+  eth_mac->rx_pool_size = num;
+  eth_mac->rx_pool_count = num;
+}
+
+/* Borrow RX frame */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_BorrowRxFrame(XMC_ETH_MAC_t *const eth_mac, XMC_ETH_MAC_RX_FRAME_t *const frame)
+{
+  XMC_ETH_MAC_STATUS_t status;
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+  uint32_t start = DWT->CYCCNT;
+#endif
+
+  XMC_ASSERT("XMC_ETH_MAC_BorrowRxFrame: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_BorrowRxFrame: frame is invalid", frame != NULL);
+
+  status = XMC_ETH_MAC_lBorrowRxFrame(eth_mac, frame);
+  if (status != XMC_ETH_MAC_STATUS_BUSY)
   {
-    /* Receive buffer unavailable, resume DMA */
-	eth_mac->regs->STATUS = (uint32_t)ETH_STATUS_RU_Msk;
-	eth_mac->regs->RECEIVE_POLL_DEMAND = 0U;
+    XMC_ETH_MAC_lResumeRx(eth_mac);
   }
 
-  return (len);
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+  XMC_ETH_MAC_lRecordRxCycles(&eth_mac->rx_cycles_borrow, start, (status == XMC_ETH_MAC_STATUS_OK) ? 1U : 0U);
+#endif
+
+  return status;
+}
+
+/* Borrow all pending RX frames */
+uint32_t XMC_ETH_MAC_BorrowRxFrames(XMC_ETH_MAC_t *const eth_mac, XMC_ETH_MAC_RX_FRAME_t *const frames, uint32_t max_frames)
+{
+  XMC_ETH_MAC_STATUS_t status;
+  uint32_t count;
+  uint32_t i;
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+  uint32_t start = DWT->CYCCNT;
+#endif
+
+  XMC_ASSERT("XMC_ETH_MAC_BorrowRxFrames: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_BorrowRxFrames: frames is invalid", frames != NULL);
+
+  count = 0U;
+  for (i = 0U; (i < eth_mac->num_rx_buf) && (count < max_frames); ++i)
+  {
+    status = XMC_ETH_MAC_lBorrowRxFrame(eth_mac, &frames[count]);
+    if (status == XMC_ETH_MAC_STATUS_OK)
+    {
+      count++;
+    }
+    else if (status == XMC_ETH_MAC_STATUS_BUSY)
+    {
+      break;
+    }
+    else
+    {
+      /* Erroneous frame dropped, continue with the next one */
+    }
+  }
+
+  /* Descriptors were returned, resume the DMA once for the whole burst */
+  if (i > 0U)
+  {
+    XMC_ETH_MAC_lResumeRx(eth_mac);
+  }
+
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+  XMC_ETH_MAC_lRecordRxCycles(&eth_mac->rx_cycles_borrow_batch, start, count);
+#endif
+
+  return count;
+}
+
+/* Read all pending RX frames */
+uint32_t XMC_ETH_MAC_ReadFrames(XMC_ETH_MAC_t *const eth_mac,
+                                XMC_ETH_MAC_RX_FRAME_HANDLER_t handler,
+                                void *const context,
+                                uint32_t max_frames)
+{
+  XMC_ETH_MAC_DMA_DESC_t *rx_desc;
+  uint32_t desc_status;
+  uint32_t count;
+  uint32_t i;
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+  uint32_t start = DWT->CYCCNT;
+#endif
+
+  XMC_ASSERT("XMC_ETH_MAC_ReadFrames: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_ReadFrames: handler is invalid", handler != NULL);
+
+  count = 0U;
+  for (i = 0U; (i < eth_mac->num_rx_buf) && (count < max_frames); ++i)
+  {
+    rx_desc = &eth_mac->rx_desc[eth_mac->rx_index];
+    desc_status = rx_desc->status;
+
+    if ((desc_status & ETH_MAC_DMA_RDES0_OWN) != 0U)
+    {
+      /* Owned by DMA, no more frames */
+      break;
+    }
+
+    if (XMC_ETH_MAC_lIsRxFrameValid(desc_status))
+    {
+      /* Frame is handed to the application in place, subtract CRC */
+      XMC_ETH_MAC_lCaptureRxTimeStamp(eth_mac, rx_desc, (const void *)rx_desc->buffer1);
+      handler((const uint8_t *)rx_desc->buffer1, ((desc_status & ETH_MAC_DMA_RDES0_FL) >> 16U) - 4U, context);
+      count++;
+    }
+
+    XMC_ETH_MAC_lReturnRxDescriptor(eth_mac);
+  }
+
+  /* Descriptors were returned, resume the DMA once for the whole burst */
+  if (i > 0U)
+  {
+    XMC_ETH_MAC_lResumeRx(eth_mac);
+  }
+
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+  XMC_ETH_MAC_lRecordRxCycles(&eth_mac->rx_cycles_batch, start, count);
+#endif
+
+  return count;
+}
+
+/* Return RX frame */
+void XMC_ETH_MAC_ReturnRxFrame(XMC_ETH_MAC_t *const eth_mac, const XMC_ETH_MAC_RX_FRAME_t *const frame)
+{
+  XMC_ASSERT("XMC_ETH_MAC_ReturnRxFrame: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_ReturnRxFrame: frame is invalid", (frame != NULL) && (frame->buffer != NULL));
+  XMC_ASSERT("XMC_ETH_MAC_ReturnRxFrame: pool is full", eth_mac->rx_pool_count < eth_mac->rx_pool_size);
+
+  /* A frame returned twice, or one not lent from this pool, must not write beyond the free list */
+  if (eth_mac->rx_pool_count < eth_mac->rx_pool_size)
+  {
+    eth_mac->rx_pool[eth_mac->rx_pool_count] = frame->buffer;
+    eth_mac->rx_pool_count++;
+  }
+}
+
+#if defined(XMC_ETH_MAC_INSTRUMENTATION_ENABLE)
+/* Start the receive cycle counters */
+void XMC_ETH_MAC_InitRxCycleCounters(XMC_ETH_MAC_t *const eth_mac)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  memset(&eth_mac->rx_cycles_single, 0, sizeof(eth_mac->rx_cycles_single));
+  memset(&eth_mac->rx_cycles_batch, 0, sizeof(eth_mac->rx_cycles_batch));
+  memset(&eth_mac->rx_cycles_borrow, 0, sizeof(eth_mac->rx_cycles_borrow));
+  memset(&eth_mac->rx_cycles_borrow_batch, 0, sizeof(eth_mac->rx_cycles_borrow_batch));
 }
+#endif
 
 /* Get RX frame size */
 uint32_t XMC_ETH_MAC_GetRxFrameSize(XMC_ETH_MAC_t *const eth_mac)
@@ -459,6 +1707,14 @@ uint32_t XMC_ETH_MAC_GetRxFrameSize(XMC_ETH_MAC_t *const eth_mac)
   return len;
 }
 
+/* Get RX checksum status */
+uint32_t XMC_ETH_MAC_GetRxChecksumStatus(const XMC_ETH_MAC_t *const eth_mac)
+{
+  XMC_ASSERT("XMC_ETH_MAC_GetRxChecksumStatus: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+
+  return XMC_ETH_MAC_lGetRxChecksumStatus(&eth_mac->rx_desc[eth_mac->rx_index]);
+}
+
 /* Set management clock divider */
 XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_SetManagmentClockDivider(XMC_ETH_MAC_t *const eth_mac)
 {
@@ -484,95 +1740,452 @@ XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_SetManagmentClockDivider(XMC_ETH_MAC_t *const e
   }
   else if (eth_mac_clk <= XMC_ETH_MAC_CLK_SPEED_150MHZ)
   {
-	*reg = XMC_ETH_MAC_MDC_DIVIDER_62;
+	*reg = XMC_ETH_MAC_MDC_DIVIDER_62;
+  }
+  else if (eth_mac_clk <= XMC_ETH_MAC_CLK_SPEED_200MHZ)
+  {
+	*reg = XMC_ETH_MAC_MDC_DIVIDER_102;
+  }
+  else if (eth_mac_clk <= XMC_ETH_MAC_CLK_SPEED_250MHZ)
+  {
+	*reg = XMC_ETH_MAC_MDC_DIVIDER_124;
+  }
+  else
+  {
+    status = XMC_ETH_MAC_STATUS_ERROR;
+  }
+
+  return status;
+}
+
+/* ETH MAC enable */
+void XMC_ETH_MAC_Enable(XMC_ETH_MAC_t *const eth_mac)
+{
+  XMC_SCU_CLOCK_EnableClock(XMC_SCU_CLOCK_ETH);
+#if UC_DEVICE != XMC4500
+  XMC_SCU_CLOCK_UngatePeripheralClock(XMC_SCU_PERIPHERAL_CLOCK_ETH0);
+#endif
+  XMC_SCU_RESET_DeassertPeripheralReset(XMC_SCU_PERIPHERAL_RESET_ETH0);
+}
+
+/* ETH MAC disable */
+void XMC_ETH_MAC_Disable(XMC_ETH_MAC_t *const eth_mac)
+{
+  XMC_SCU_RESET_AssertPeripheralReset(XMC_SCU_PERIPHERAL_RESET_ETH0);
+#if UC_DEVICE != XMC4500
+  XMC_SCU_CLOCK_GatePeripheralClock(XMC_SCU_PERIPHERAL_CLOCK_ETH0);
+#endif
+  XMC_SCU_CLOCK_DisableClock(XMC_SCU_CLOCK_ETH);
+}
+
+/* Start a PHY register access, the MII busy bit is set until it completes */
+static void XMC_ETH_MAC_lStartPhyAccess(XMC_ETH_MAC_t *const eth_mac,
+                                        uint8_t phy_addr,
+                                        uint8_t reg_addr,
+                                        bool write,
+                                        uint16_t data)
+{
+  uint32_t ctrl;
+
+  ctrl = (uint32_t)((eth_mac->regs->GMII_ADDRESS & (uint32_t)ETH_GMII_ADDRESS_CR_Msk) |
+                    (uint32_t)ETH_GMII_ADDRESS_MB_Msk |
+                    (uint32_t)((uint32_t)phy_addr << ETH_GMII_ADDRESS_PA_Pos) |
+                    (uint32_t)((uint32_t)reg_addr << ETH_GMII_ADDRESS_MR_Pos));
+
+  if (write)
+  {
+    eth_mac->regs->GMII_DATA = data;
+    ctrl |= (uint32_t)ETH_GMII_ADDRESS_MW_Msk;
+  }
+
+  eth_mac->regs->GMII_ADDRESS = ctrl;
+}
+
+/* Check if a PHY register access is in progress */
+__STATIC_INLINE bool XMC_ETH_MAC_lIsPhyBusy(const XMC_ETH_MAC_t *const eth_mac)
+{
+  return ((eth_mac->regs->GMII_ADDRESS & ETH_GMII_ADDRESS_MB_Msk) != 0U);
+}
+
+/*
+ * Take the MDIO interface for a blocking access. Waits during max PHY_TIMEOUT time for the
+ * access in transfer to end. An access of the non-blocking engine ending meanwhile has its
+ * result latched, XMC_ETH_MAC_ProcessMdio() completes it later.
+ */
+static XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_lClaimPhy(XMC_ETH_MAC_t *const eth_mac)
+{
+  XMC_ETH_MAC_MDIO_t *const mdio = eth_mac->mdio;
+  uint32_t primask;
+  uint32_t retries;
+  bool claimed;
+
+  claimed = (mdio == NULL);
+  retries = 0U;
+  while (!claimed && (retries < XMC_ETH_MAC_PHY_MAX_RETRIES))
+  {
+    primask = XMC_EnterCriticalSection();
+    if (!mdio->blocking && !XMC_ETH_MAC_lIsPhyBusy(eth_mac))
+    {
+      if (mdio->active && !mdio->latched)
+      {
+        mdio->latched_data = (uint16_t)(eth_mac->regs->GMII_DATA & ETH_GMII_DATA_MD_Msk);
+        mdio->latched = true;
+      }
+      mdio->blocking = true;
+      claimed = true;
+    }
+    XMC_ExitCriticalSection(primask);
+    ++retries;
+  }
+
+  return (claimed ? XMC_ETH_MAC_STATUS_OK : XMC_ETH_MAC_STATUS_ERROR);
+}
+
+/* Hand the MDIO interface back to the non-blocking engine */
+__STATIC_INLINE void XMC_ETH_MAC_lReleasePhy(XMC_ETH_MAC_t *const eth_mac)
+{
+  if (eth_mac->mdio != NULL)
+  {
+    eth_mac->mdio->blocking = false;
+  }
+}
+
+/* Poll busy bit during max PHY_TIMEOUT time */
+static XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_lWaitPhy(const XMC_ETH_MAC_t *const eth_mac)
+{
+  uint32_t retries;
+
+  retries = 0U;
+  do
+  {
+    if (!XMC_ETH_MAC_lIsPhyBusy(eth_mac))
+    {
+      return XMC_ETH_MAC_STATUS_OK;
+    }
+    ++retries;
+  } while (retries < XMC_ETH_MAC_PHY_MAX_RETRIES);
+
+  return XMC_ETH_MAC_STATUS_ERROR;
+}
+
+/* Read physical layer and obtain status */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_ReadPhy(XMC_ETH_MAC_t *eth_mac, uint8_t phy_addr, uint8_t reg_addr, uint16_t *data)
+{
+  XMC_ETH_MAC_STATUS_t status;
+
+  XMC_ASSERT("XMC_ETH_MAC_PhyRead: Parameter error", data != NULL);
+
+  status = XMC_ETH_MAC_lClaimPhy(eth_mac);
+  if (status == XMC_ETH_MAC_STATUS_OK)
+  {
+    XMC_ETH_MAC_lStartPhyAccess(eth_mac, phy_addr, reg_addr, false, 0U);
+
+    status = XMC_ETH_MAC_lWaitPhy(eth_mac);
+    if (status == XMC_ETH_MAC_STATUS_OK)
+    {
+      *data = (uint16_t)(eth_mac->regs->GMII_DATA & ETH_GMII_DATA_MD_Msk);
+    }
+
+    XMC_ETH_MAC_lReleasePhy(eth_mac);
+  }
+
+  return status;
+}
+
+/* Write physical layer and return status */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_WritePhy(XMC_ETH_MAC_t *eth_mac, uint8_t phy_addr, uint8_t reg_addr, uint16_t data)
+{
+  XMC_ETH_MAC_STATUS_t status;
+
+  status = XMC_ETH_MAC_lClaimPhy(eth_mac);
+  if (status == XMC_ETH_MAC_STATUS_OK)
+  {
+    XMC_ETH_MAC_lStartPhyAccess(eth_mac, phy_addr, reg_addr, true, data);
+
+    status = XMC_ETH_MAC_lWaitPhy(eth_mac);
+
+    XMC_ETH_MAC_lReleasePhy(eth_mac);
   }
-  else if (eth_mac_clk <= XMC_ETH_MAC_CLK_SPEED_200MHZ)
+
+  return status;
+}
+
+/* Queue a PHY register access */
+static XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_lQueuePhyRequest(XMC_ETH_MAC_t *const eth_mac,
+                                                         const XMC_ETH_MAC_MDIO_REQUEST_t *const request)
+{
+  XMC_ETH_MAC_MDIO_t *const mdio = eth_mac->mdio;
+  XMC_ETH_MAC_STATUS_t status;
+  uint32_t primask;
+  uint32_t next;
+
+  /* Requests are queued from thread and interrupt context alike */
+  primask = XMC_EnterCriticalSection();
+
+  next = (uint32_t)mdio->head + 1U;
+  if (next == mdio->size)
   {
-	*reg = XMC_ETH_MAC_MDC_DIVIDER_102;
+    next = 0U;
   }
-  else if (eth_mac_clk <= XMC_ETH_MAC_CLK_SPEED_250MHZ)
+
+  if (next == mdio->tail)
   {
-	*reg = XMC_ETH_MAC_MDC_DIVIDER_124;
+    /* Queue is full */
+    status = XMC_ETH_MAC_STATUS_BUSY;
   }
   else
   {
-    status = XMC_ETH_MAC_STATUS_ERROR;
+    mdio->requests[mdio->head] = *request;
+    mdio->head = (uint8_t)next;
+    status = XMC_ETH_MAC_STATUS_OK;
   }
 
+  XMC_ExitCriticalSection(primask);
+
   return status;
 }
 
-/* ETH MAC enable */
-void XMC_ETH_MAC_Enable(XMC_ETH_MAC_t *const eth_mac)
+/* Completion of the link state poller read */
+static void XMC_ETH_MAC_lLinkPollDone(XMC_ETH_MAC_STATUS_t status, uint16_t data, void *context)
 {
-  XMC_SCU_CLOCK_EnableClock(XMC_SCU_CLOCK_ETH);
-#if UC_DEVICE != XMC4500
-  XMC_SCU_CLOCK_UngatePeripheralClock(XMC_SCU_PERIPHERAL_CLOCK_ETH0);
-#endif
-  XMC_SCU_RESET_DeassertPeripheralReset(XMC_SCU_PERIPHERAL_RESET_ETH0);
+  XMC_ETH_MAC_t *const eth_mac = (XMC_ETH_MAC_t *)context;
+  XMC_ETH_MAC_MDIO_t *const mdio = eth_mac->mdio;
+  XMC_ETH_LINK_STATUS_t link;
+
+  mdio->link_poll_pending = false;
+
+  if (status == XMC_ETH_MAC_STATUS_OK)
+  {
+    link = ((data & XMC_ETH_MAC_PHY_BMSR_LINK_STATUS) != 0U) ? XMC_ETH_LINK_STATUS_UP : XMC_ETH_LINK_STATUS_DOWN;
+    if (link != mdio->link_status)
+    {
+      mdio->link_status = link;
+      if (mdio->link_handler != NULL)
+      {
+        mdio->link_handler(link);
+      }
+    }
+  }
 }
 
-/* ETH MAC disable */
-void XMC_ETH_MAC_Disable(XMC_ETH_MAC_t *const eth_mac)
+/* Initialize non-blocking MDIO engine */
+void XMC_ETH_MAC_InitMdio(XMC_ETH_MAC_t *const eth_mac,
+                          XMC_ETH_MAC_MDIO_t *const mdio,
+                          XMC_ETH_MAC_MDIO_REQUEST_t *const requests,
+                          uint8_t size,
+                          uint32_t timeout)
 {
-  XMC_SCU_RESET_AssertPeripheralReset(XMC_SCU_PERIPHERAL_RESET_ETH0);
-#if UC_DEVICE != XMC4500
-  XMC_SCU_CLOCK_GatePeripheralClock(XMC_SCU_PERIPHERAL_CLOCK_ETH0);
-#endif
-  XMC_SCU_CLOCK_DisableClock(XMC_SCU_CLOCK_ETH);
+  XMC_ASSERT("XMC_ETH_MAC_InitMdio: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_InitMdio: mdio is invalid", (mdio != NULL) && (requests != NULL) && (size > 1U));
+
+  mdio->requests = requests;
+  mdio->size = size;
+  mdio->head = 0U;
+  mdio->tail = 0U;
+  mdio->active = false;
+  mdio->blocking = false;
+  mdio->latched = false;
+  mdio->latched_data = 0U;
+  mdio->timeout = timeout;
+  mdio->elapsed = 0U;
+  mdio->link_handler = NULL;
+  mdio->link_interval = 0U;
+  mdio->link_countdown = 0U;
+  mdio->link_status = XMC_ETH_LINK_STATUS_DOWN;
+  mdio->link_poll_pending = false;
+
+  eth_mac->mdio = mdio;
 }
 
-/* Read physical layer and obtain status */
-XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_ReadPhy(XMC_ETH_MAC_t *eth_mac, uint8_t phy_addr, uint8_t reg_addr, uint16_t *data)
+/* Queue PHY register read */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_ReadPhyAsync(XMC_ETH_MAC_t *const eth_mac,
+                                              uint8_t phy_addr,
+                                              uint8_t reg_addr,
+                                              XMC_ETH_MAC_MDIO_HANDLER_t handler,
+                                              void *const context)
 {
-  uint32_t retries;
+  XMC_ETH_MAC_MDIO_REQUEST_t request;
 
-  XMC_ASSERT("XMC_ETH_MAC_PhyRead: Parameter error", data != NULL);
+  XMC_ASSERT("XMC_ETH_MAC_ReadPhyAsync: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_ReadPhyAsync: MDIO engine not initialized", eth_mac->mdio != NULL);
+  XMC_ASSERT("XMC_ETH_MAC_ReadPhyAsync: handler is invalid", handler != NULL);
 
-  eth_mac->regs->GMII_ADDRESS = (uint32_t)((eth_mac->regs->GMII_ADDRESS & (uint32_t)ETH_GMII_ADDRESS_CR_Msk) |
-                                           (uint32_t)ETH_GMII_ADDRESS_MB_Msk |
-                                           (uint32_t)((uint32_t)phy_addr << ETH_GMII_ADDRESS_PA_Pos) |
-                                           (uint32_t)((uint32_t)reg_addr << ETH_GMII_ADDRESS_MR_Pos));
+  request.handler = handler;
+  request.context = context;
+  request.data = 0U;
+  request.phy_addr = phy_addr;
+  request.reg_addr = reg_addr;
+  request.write = false;
 
-  /* Poll busy bit during max PHY_TIMEOUT time */
-  retries = 0U;
-  do
-  {
-    if ((eth_mac->regs->GMII_ADDRESS & ETH_GMII_ADDRESS_MB_Msk) == 0U)
-    {
-      *data = (uint16_t)(eth_mac->regs->GMII_DATA & ETH_GMII_DATA_MD_Msk);
-      return XMC_ETH_MAC_STATUS_OK;
-    }
-    ++retries;
-  } while (retries < XMC_ETH_MAC_PHY_MAX_RETRIES);
+  return XMC_ETH_MAC_lQueuePhyRequest(eth_mac, &request);
+}
 
-  return XMC_ETH_MAC_STATUS_ERROR;
+/* Queue PHY register write */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_WritePhyAsync(XMC_ETH_MAC_t *const eth_mac,
+                                               uint8_t phy_addr,
+                                               uint8_t reg_addr,
+                                               uint16_t data,
+                                               XMC_ETH_MAC_MDIO_HANDLER_t handler,
+                                               void *const context)
+{
+  XMC_ETH_MAC_MDIO_REQUEST_t request;
+
+  XMC_ASSERT("XMC_ETH_MAC_WritePhyAsync: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_WritePhyAsync: MDIO engine not initialized", eth_mac->mdio != NULL);
+
+  request.handler = handler;
+  request.context = context;
+  request.data = data;
+  request.phy_addr = phy_addr;
+  request.reg_addr = reg_addr;
+  request.write = true;
+
+  return XMC_ETH_MAC_lQueuePhyRequest(eth_mac, &request);
 }
 
-/* Write physical layer and return status */
-XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_WritePhy(XMC_ETH_MAC_t *eth_mac, uint8_t phy_addr, uint8_t reg_addr, uint16_t data)
+/* Start link state polling */
+void XMC_ETH_MAC_StartLinkPolling(XMC_ETH_MAC_t *const eth_mac,
+                                  uint8_t phy_addr,
+                                  uint32_t interval,
+                                  XMC_ETH_MAC_LINK_HANDLER_t handler)
 {
-  uint32_t retries;
+  XMC_ETH_MAC_MDIO_t *mdio;
 
-  eth_mac->regs->GMII_DATA  = data;
-  eth_mac->regs->GMII_ADDRESS = (uint32_t)((eth_mac->regs->GMII_ADDRESS & (uint32_t)ETH_GMII_ADDRESS_CR_Msk) |
-                                           (uint32_t)ETH_GMII_ADDRESS_MB_Msk |
-                                           (uint32_t)ETH_GMII_ADDRESS_MW_Msk |
-                                           (uint32_t)((uint32_t)phy_addr << ETH_GMII_ADDRESS_PA_Pos) |
-                                           (uint32_t)((uint32_t)reg_addr << ETH_GMII_ADDRESS_MR_Pos));
+  XMC_ASSERT("XMC_ETH_MAC_StartLinkPolling: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_StartLinkPolling: MDIO engine not initialized", eth_mac->mdio != NULL);
+  XMC_ASSERT("XMC_ETH_MAC_StartLinkPolling: interval is invalid", interval > 0U);
 
-   /* Poll busy bit during max PHY_TIMEOUT time */
-  retries = 0U;
-  do
+  mdio = eth_mac->mdio;
+  mdio->link_phy_addr = phy_addr;
+  mdio->link_handler = handler;
+  mdio->link_interval = interval;
+  mdio->link_countdown = 0U;
+}
+
+/* Stop link state polling */
+void XMC_ETH_MAC_StopLinkPolling(XMC_ETH_MAC_t *const eth_mac)
+{
+  XMC_ASSERT("XMC_ETH_MAC_StopLinkPolling: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_StopLinkPolling: MDIO engine not initialized", eth_mac->mdio != NULL);
+
+  eth_mac->mdio->link_interval = 0U;
+}
+
+/* Run the non-blocking MDIO engine */
+void XMC_ETH_MAC_ProcessMdio(XMC_ETH_MAC_t *const eth_mac)
+{
+  XMC_ETH_MAC_MDIO_t *mdio;
+  const XMC_ETH_MAC_MDIO_REQUEST_t *request;
+  XMC_ETH_MAC_STATUS_t status;
+  XMC_ETH_MAC_MDIO_REQUEST_t poll;
+  XMC_ETH_MAC_MDIO_REQUEST_t completed;
+  uint16_t data;
+  uint32_t primask;
+  uint32_t next;
+
+  XMC_ASSERT("XMC_ETH_MAC_ProcessMdio: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_ProcessMdio: MDIO engine not initialized", eth_mac->mdio != NULL);
+
+  mdio = eth_mac->mdio;
+
+  /* Link state poller queues a status register read every interval */
+  if (mdio->link_interval != 0U)
   {
-    if ((eth_mac->regs->GMII_ADDRESS & ETH_GMII_ADDRESS_MB_Msk) == 0U)
+    if (mdio->link_countdown == 0U)
     {
-      return XMC_ETH_MAC_STATUS_OK;
+      if (!mdio->link_poll_pending)
+      {
+        poll.handler = XMC_ETH_MAC_lLinkPollDone;
+        poll.context = eth_mac;
+        poll.data = 0U;
+        poll.phy_addr = mdio->link_phy_addr;
+        poll.reg_addr = XMC_ETH_MAC_PHY_REG_BMSR;
+        poll.write = false;
+        if (XMC_ETH_MAC_lQueuePhyRequest(eth_mac, &poll) == XMC_ETH_MAC_STATUS_OK)
+        {
+          mdio->link_poll_pending = true;
+        }
+      }
+      mdio->link_countdown = mdio->link_interval;
     }
-    ++retries;
-  } while (retries < XMC_ETH_MAC_PHY_MAX_RETRIES);
+    mdio->link_countdown--;
+  }
 
-  return XMC_ETH_MAC_STATUS_ERROR;
+  if (mdio->active)
+  {
+    status = XMC_ETH_MAC_STATUS_BUSY;
+    data = 0U;
+    if (mdio->latched)
+    {
+      /* Ended before a blocking access took the interface */
+      status = XMC_ETH_MAC_STATUS_OK;
+    }
+    else if (XMC_ETH_MAC_lIsPhyBusy(eth_mac))
+    {
+      mdio->elapsed++;
+      if ((mdio->timeout != 0U) && (mdio->elapsed >= mdio->timeout))
+      {
+        status = XMC_ETH_MAC_STATUS_ERROR;
+      }
+      /* Otherwise the access is still in progress, try again on the next call */
+    }
+    else
+    {
+      status = XMC_ETH_MAC_STATUS_OK;
+    }
+
+    if (status != XMC_ETH_MAC_STATUS_BUSY)
+    {
+      /*
+       * Copy the entry and release it before the handler, so the handler can queue a
+       * follow-up access that may reuse the slot
+       */
+      completed = mdio->requests[mdio->tail];
+      if (completed.write)
+      {
+        data = completed.data;
+      }
+      else if (mdio->latched)
+      {
+        data = mdio->latched_data;
+      }
+      else if (status == XMC_ETH_MAC_STATUS_OK)
+      {
+        data = (uint16_t)(eth_mac->regs->GMII_DATA & ETH_GMII_DATA_MD_Msk);
+      }
+      else
+      {
+        /* Timed out, no data */
+      }
+
+      primask = XMC_EnterCriticalSection();
+      mdio->active = false;
+      mdio->latched = false;
+      next = (uint32_t)mdio->tail + 1U;
+      if (next == mdio->size)
+      {
+        next = 0U;
+      }
+      mdio->tail = (uint8_t)next;
+      XMC_ExitCriticalSection(primask);
+
+      if (completed.handler != NULL)
+      {
+        completed.handler(status, data, completed.context);
+      }
+    }
+  }
+
+  /* A blocking XMC_ETH_MAC_ReadPhy()/XMC_ETH_MAC_WritePhy() may hold the interface meanwhile */
+  primask = XMC_EnterCriticalSection();
+  if (!mdio->active && !mdio->blocking && (mdio->tail != mdio->head) && !XMC_ETH_MAC_lIsPhyBusy(eth_mac))
+  {
+    request = &mdio->requests[mdio->tail];
+    XMC_ETH_MAC_lStartPhyAccess(eth_mac, request->phy_addr, request->reg_addr, request->write, request->data);
+    mdio->active = true;
+    mdio->elapsed = 0U;
+  }
+  XMC_ExitCriticalSection(primask);
 }
 
 /* Flush TX */
@@ -587,7 +2200,7 @@ void XMC_ETH_MAC_FlushTx(XMC_ETH_MAC_t *const eth_mac)
 void XMC_ETH_MAC_FlushRx(XMC_ETH_MAC_t *const eth_mac)
 {
   eth_mac->regs->OPERATION_MODE &= (uint32_t)~ETH_OPERATION_MODE_SR_Msk;
-  XMC_ETH_MAC_InitRxDescriptors(eth_mac);
+  XMC_ETH_MAC_lInitRxDescriptors(eth_mac, true);
   eth_mac->regs->OPERATION_MODE |= (uint32_t)ETH_OPERATION_MODE_SR_Msk;
 }
 
@@ -605,6 +2218,222 @@ void XMC_ETH_MAC_SetWakeUpFrameFilter(XMC_ETH_MAC_t *const eth_mac,
   }
 }
 
+/* Initialize time stamp ring */
+void XMC_ETH_MAC_InitTimeStampRing(XMC_ETH_MAC_t *const eth_mac,
+                                   XMC_ETH_MAC_TIMESTAMP_RING_t *const ring,
+                                   XMC_ETH_MAC_TIMESTAMP_t *const entries,
+                                   uint8_t size)
+{
+  XMC_ASSERT("XMC_ETH_MAC_InitTimeStampRing: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_InitTimeStampRing: ring is invalid", (ring != NULL) && (entries != NULL) && (size > 1U));
+
+  ring->entries = entries;
+  ring->size = size;
+  ring->head = 0U;
+  ring->tail = 0U;
+  ring->overruns = 0U;
+
+  eth_mac->ts_ring = ring;
+}
+
+/* Read time stamp from ring */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_ReadTimeStamp(XMC_ETH_MAC_t *const eth_mac, XMC_ETH_MAC_TIMESTAMP_t *const timestamp)
+{
+  XMC_ETH_MAC_TIMESTAMP_RING_t *ring;
+  XMC_ETH_MAC_STATUS_t status;
+  uint32_t next;
+
+  XMC_ASSERT("XMC_ETH_MAC_ReadTimeStamp: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_ReadTimeStamp: ring not initialized", eth_mac->ts_ring != NULL);
+  XMC_ASSERT("XMC_ETH_MAC_ReadTimeStamp: timestamp is invalid", timestamp != NULL);
+
+  ring = eth_mac->ts_ring;
+  if (ring->tail == ring->head)
+  {
+    status = XMC_ETH_MAC_STATUS_BUSY;
+  }
+  else
+  {
+    *timestamp = ring->entries[ring->tail];
+
+    next = (uint32_t)ring->tail + 1U;
+    if (next == ring->size)
+    {
+      next = 0U;
+    }
+    ring->tail = (uint8_t)next;
+
+    status = XMC_ETH_MAC_STATUS_OK;
+  }
+
+  return status;
+}
+
+/* Initialize PTP servo */
+void XMC_ETH_MAC_InitPTPServo(XMC_ETH_MAC_t *const eth_mac,
+                              XMC_ETH_MAC_PTP_SERVO_t *const servo,
+                              const XMC_ETH_MAC_PTP_SERVO_CONFIG_t *const config)
+{
+  XMC_ASSERT("XMC_ETH_MAC_InitPTPServo: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_InitPTPServo: servo is invalid", (servo != NULL) && (config != NULL));
+  XMC_ASSERT("XMC_ETH_MAC_InitPTPServo: fine update not enabled",
+             (eth_mac->regs->TIMESTAMP_CONTROL & (uint32_t)XMC_ETH_MAC_TIMESTAMP_CONFIG_FINE_UPDATE) != 0U);
+
+  servo->config = config;
+
+  /* Addend programmed by XMC_ETH_MAC_InitPTP() is the nominal frequency */
+  servo->addend = eth_mac->regs->TIMESTAMP_ADDEND;
+  servo->integral = 0;
+  servo->freq_ppb = 0;
+
+  XMC_ETH_MAC_ResetPTPServoStatistics(servo);
+}
+
+/* Reset PTP servo statistics */
+void XMC_ETH_MAC_ResetPTPServoStatistics(XMC_ETH_MAC_PTP_SERVO_t *const servo)
+{
+  XMC_ASSERT("XMC_ETH_MAC_ResetPTPServoStatistics: servo is invalid", servo != NULL);
+
+  servo->stats.samples = 0U;
+  servo->stats.steps = 0U;
+  servo->stats.offset = 0;
+  servo->stats.offset_min = INT32_MAX;
+  servo->stats.offset_max = INT32_MIN;
+  servo->stats.offset_mean = 0;
+  servo->stats.jitter = 0U;
+}
+
+/* Step PTP clock by an offset in nanoseconds */
+static void XMC_ETH_MAC_lStepPTPClock(XMC_ETH_MAC_t *const eth_mac, int32_t offset)
+{
+  uint32_t magnitude;
+  uint32_t subseconds;
+
+  magnitude = (offset < 0) ? (uint32_t)(-(int64_t)offset) : (uint32_t)offset;
+  subseconds = (uint32_t)((((uint64_t)magnitude % (uint64_t)XMC_ETH_MAC_PTP_NANOSECONDS_PER_SECOND) *
+                           XMC_ETH_MAC_PTP_SUBSECONDS_PER_SECOND) / (uint64_t)XMC_ETH_MAC_PTP_NANOSECONDS_PER_SECOND);
+
+  /* Local clock ahead of the master: subtract the offset */
+  if (offset > 0)
+  {
+    subseconds |= (uint32_t)ETH_SYSTEM_TIME_NANOSECONDS_UPDATE_ADDSUB_Msk;
+  }
+
+  eth_mac->regs->SYSTEM_TIME_SECONDS_UPDATE = magnitude / (uint32_t)XMC_ETH_MAC_PTP_NANOSECONDS_PER_SECOND;
+  eth_mac->regs->SYSTEM_TIME_NANOSECONDS_UPDATE = subseconds;
+  eth_mac->regs->TIMESTAMP_CONTROL |= (uint32_t)ETH_TIMESTAMP_CONTROL_TSUPDT_Msk;
+}
+
+/* Feed one offset sample to the PTP servo and apply the correction */
+static void XMC_ETH_MAC_lUpdatePTPServo(XMC_ETH_MAC_t *const eth_mac,
+                                        XMC_ETH_MAC_PTP_SERVO_t *const servo,
+                                        int32_t offset)
+{
+  const XMC_ETH_MAC_PTP_SERVO_CONFIG_t *config;
+  XMC_ETH_MAC_PTP_STATISTICS_t *stats;
+  int64_t integral_max;
+  int64_t freq;
+  uint32_t magnitude;
+  uint32_t delta;
+
+  config = servo->config;
+  stats = &servo->stats;
+
+  /* Offset and jitter statistics, jitter is the filtered difference between consecutive offsets */
+  if (stats->samples != 0U)
+  {
+    delta = (offset > stats->offset) ? (uint32_t)((int64_t)offset - stats->offset) : (uint32_t)((int64_t)stats->offset - offset);
+    stats->jitter = (uint32_t)((int64_t)stats->jitter +
+                               (((int64_t)delta - (int64_t)stats->jitter) / (1L << XMC_ETH_MAC_PTP_FILTER_SHIFT)));
+    stats->offset_mean = (int32_t)((int64_t)stats->offset_mean +
+                                   (((int64_t)offset - (int64_t)stats->offset_mean) / (1L << XMC_ETH_MAC_PTP_FILTER_SHIFT)));
+  }
+  else
+  {
+    stats->offset_mean = offset;
+  }
+  stats->samples++;
+  stats->offset = offset;
+  stats->offset_min = (offset < stats->offset_min) ? offset : stats->offset_min;
+  stats->offset_max = (offset > stats->offset_max) ? offset : stats->offset_max;
+
+  magnitude = (offset < 0) ? (uint32_t)(-(int64_t)offset) : (uint32_t)offset;
+  if ((config->step_threshold != 0U) && (magnitude > config->step_threshold))
+  {
+    /* Too far off to be steered, step the clock and restart the integrator */
+    XMC_ETH_MAC_lStepPTPClock(eth_mac, offset);
+    servo->integral = 0;
+    stats->steps++;
+  }
+  else
+  {
+    servo->integral += offset;
+
+    /* Anti-windup: the integral term alone must not exceed the frequency limit */
+    if (config->ki != 0)
+    {
+      integral_max = ((int64_t)config->max_ppb << 16) / ((config->ki < 0) ? -(int64_t)config->ki : (int64_t)config->ki);
+      if (servo->integral > integral_max)
+      {
+        servo->integral = integral_max;
+      }
+      else if (servo->integral < -integral_max)
+      {
+        servo->integral = -integral_max;
+      }
+      else
+      {
+        /* Within limits */
+      }
+    }
+
+    /* Gains are Q16 ppb per nanosecond, a positive offset (local clock ahead) slows the clock down */
+    freq = -((((int64_t)config->kp * offset) + ((int64_t)config->ki * servo->integral)) / 65536);
+    if (freq > config->max_ppb)
+    {
+      freq = config->max_ppb;
+    }
+    else if (freq < -(int64_t)config->max_ppb)
+    {
+      freq = -(int64_t)config->max_ppb;
+    }
+    else
+    {
+      /* Within limits */
+    }
+    servo->freq_ppb = (int32_t)freq;
+
+    eth_mac->regs->TIMESTAMP_ADDEND = (uint32_t)((int64_t)servo->addend +
+                                                 (((int64_t)servo->addend * freq) / XMC_ETH_MAC_PTP_NANOSECONDS_PER_SECOND));
+    eth_mac->regs->TIMESTAMP_CONTROL |= (uint32_t)ETH_TIMESTAMP_CONTROL_TSADDREG_Msk;
+  }
+}
+
+/* Update PTP servo */
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_UpdatePTPServo(XMC_ETH_MAC_t *const eth_mac,
+                                                XMC_ETH_MAC_PTP_SERVO_t *const servo,
+                                                int32_t offset)
+{
+  XMC_ETH_MAC_STATUS_t status;
+
+  XMC_ASSERT("XMC_ETH_MAC_UpdatePTPServo: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_UpdatePTPServo: servo is invalid", (servo != NULL) && (servo->config != NULL));
+
+  if ((eth_mac->regs->TIMESTAMP_CONTROL & ((uint32_t)ETH_TIMESTAMP_CONTROL_TSADDREG_Msk |
+                                           (uint32_t)ETH_TIMESTAMP_CONTROL_TSUPDT_Msk)) != 0U)
+  {
+    /* Previous correction not yet applied by the hardware */
+    status = XMC_ETH_MAC_STATUS_BUSY;
+  }
+  else
+  {
+    XMC_ETH_MAC_lUpdatePTPServo(eth_mac, servo, offset);
+    status = XMC_ETH_MAC_STATUS_OK;
+  }
+
+  return status;
+}
+
 /* Enable event */
 void XMC_ETH_MAC_EnableEvent(XMC_ETH_MAC_t *const eth_mac, uint32_t event)
 {
@@ -637,6 +2466,101 @@ void XMC_ETH_MAC_DisableEvent(XMC_ETH_MAC_t *const eth_mac, uint32_t event)
   eth_mac->regs->INTERRUPT_ENABLE &= ~event;
 }
 
+/* Set receive interrupt watchdog */
+void XMC_ETH_MAC_SetRxInterruptWatchdog(XMC_ETH_MAC_t *const eth_mac, uint8_t watchdog)
+{
+  uint32_t i;
+
+  XMC_ASSERT("XMC_ETH_MAC_SetRxInterruptWatchdog: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+
+  eth_mac->rx_watchdog = watchdog;
+  eth_mac->regs->RECEIVE_INTERRUPT_WATCHDOG_TIMER = (uint32_t)watchdog;
+
+  /*
+   * RDES1 is never written back by the DMA, the interrupt on completion control
+   * can be changed while the descriptor is owned by the DMA
+   */
+  for (i = 0U; i < eth_mac->num_rx_buf; ++i)
+  {
+    if (watchdog != 0U)
+    {
+      eth_mac->rx_desc[i].length |= (uint32_t)ETH_MAC_DMA_RDES1_DIC;
+    }
+    else
+    {
+      eth_mac->rx_desc[i].length &= (uint32_t)~ETH_MAC_DMA_RDES1_DIC;
+    }
+  }
+}
+
+/* Set transmit interrupt coalescing */
+void XMC_ETH_MAC_SetTxInterruptCoalescing(XMC_ETH_MAC_t *const eth_mac, uint8_t frames)
+{
+  XMC_ASSERT("XMC_ETH_MAC_SetTxInterruptCoalescing: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+
+  eth_mac->tx_coalesce_frames = frames;
+  eth_mac->tx_coalesce_count = 0U;
+}
+
+/* Initialize adaptive interrupt coalescing */
+void XMC_ETH_MAC_InitCoalescing(XMC_ETH_MAC_t *const eth_mac, const XMC_ETH_MAC_COALESCE_CONFIG_t *const config)
+{
+  XMC_ASSERT("XMC_ETH_MAC_InitCoalescing: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_InitCoalescing: config is invalid", (config != NULL) && (config->rate_high > config->rate_low));
+
+  eth_mac->coalesce_config = config;
+
+  /* Start from a quiet link: interrupt on every frame */
+  XMC_ETH_MAC_SetRxInterruptWatchdog(eth_mac, 0U);
+  XMC_ETH_MAC_SetTxInterruptCoalescing(eth_mac, 0U);
+}
+
+/* Update adaptive interrupt coalescing */
+void XMC_ETH_MAC_UpdateCoalescing(XMC_ETH_MAC_t *const eth_mac, uint32_t frames)
+{
+  const XMC_ETH_MAC_COALESCE_CONFIG_t *config;
+  uint32_t watchdog;
+  uint32_t tx_frames;
+  uint32_t span;
+  uint32_t load;
+
+  XMC_ASSERT("XMC_ETH_MAC_UpdateCoalescing: eth_mac is invalid", XMC_ETH_MAC_IsValidModule(eth_mac->regs));
+  XMC_ASSERT("XMC_ETH_MAC_UpdateCoalescing: coalescing not initialized", eth_mac->coalesce_config != NULL);
+
+  config = eth_mac->coalesce_config;
+
+  if (frames <= config->rate_low)
+  {
+    /* Quiet link, no added latency */
+    watchdog = 0U;
+    tx_frames = 0U;
+  }
+  else if (frames >= config->rate_high)
+  {
+    watchdog = config->rx_watchdog_max;
+    tx_frames = config->tx_frames_max;
+  }
+  else
+  {
+    /* Scale the delay linearly with the frame rate between both thresholds */
+    span = (uint32_t)config->rate_high - (uint32_t)config->rate_low;
+    load = frames - (uint32_t)config->rate_low;
+    watchdog = (((uint32_t)config->rx_watchdog_max * load) + (span - 1U)) / span;
+    tx_frames = (((uint32_t)config->tx_frames_max * load) + (span - 1U)) / span;
+  }
+
+  /* Reprogram only on change, the watchdog update walks the RX ring */
+  if (watchdog != eth_mac->rx_watchdog)
+  {
+    XMC_ETH_MAC_SetRxInterruptWatchdog(eth_mac, (uint8_t)watchdog);
+  }
+
+  if (tx_frames != eth_mac->tx_coalesce_frames)
+  {
+    XMC_ETH_MAC_SetTxInterruptCoalescing(eth_mac, (uint8_t)tx_frames);
+  }
+}
+
 /* Clear event status */
 void XMC_ETH_MAC_ClearEventStatus(XMC_ETH_MAC_t *const eth_mac, uint32_t event)
 {
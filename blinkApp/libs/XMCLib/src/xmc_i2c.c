@@ -36,6 +36,9 @@
  * Change History
  * --------------
  *
+ * 2026-10-17:
+ *     - Added interrupt driven queue of master transactions on the USIC FIFOs <br>
+ *
  * 2015-02-20:
  *     - Initial <br>
  *      
@@ -73,6 +76,13 @@
 #define WORDLENGTH              (7U)        /**< Word length */
 #define SET_TDV                 (1U)		/**< Transmission data valid */
 #define XMC_I2C_10BIT_ADDR_MASK (0x7C00U)   /**< Address mask for 10-bit mode */
+#define XMC_I2C_READ_BIT        (0x1U)      /**< Read command bit of the address byte */
+#define XMC_I2C_CH_SERVICE_REQUEST_MAX (5U) /**< Last service request line */
+#define XMC_I2C_CH_QUEUE_STATUS_FLAGS ((uint32_t)XMC_I2C_CH_STATUS_FLAG_NACK_RECEIVED | \
+                                       (uint32_t)XMC_I2C_CH_STATUS_FLAG_ARBITRATION_LOST | \
+                                       (uint32_t)XMC_I2C_CH_STATUS_FLAG_ERROR | \
+                                       (uint32_t)XMC_I2C_CH_STATUS_FLAG_WRONG_TDF_CODE_FOUND | \
+                                       (uint32_t)XMC_I2C_CH_STATUS_FLAG_STOP_CONDITION_RECEIVED) /**< Flags handled by the transaction queue */
 
 /*********************************************************************************************************************
  * ENUMS
@@ -101,6 +111,190 @@ typedef enum XMC_I2C_CH_CLOCK_OVERSAMPLING
   XMC_I2C_CH_CLOCK_OVERSAMPLING_FAST     = 25U
 } XMC_I2C_CH_CLOCK_OVERSAMPLINGS_t;
 
+/* Next command of a queued transaction */
+typedef enum XMC_I2C_CH_QUEUE_STEP
+{
+  XMC_I2C_CH_QUEUE_STEP_IDLE,      /* No transaction in transfer */
+  XMC_I2C_CH_QUEUE_STEP_START,     /* Start condition and address */
+  XMC_I2C_CH_QUEUE_STEP_WRITE,     /* Data bytes to write, then repeated start or stop */
+  XMC_I2C_CH_QUEUE_STEP_READ,      /* Receive commands, the last one with NACK */
+  XMC_I2C_CH_QUEUE_STEP_STOP,      /* Stop condition */
+  XMC_I2C_CH_QUEUE_STEP_WAIT_STOP  /* All commands written, waiting for the stop condition on the bus */
+} XMC_I2C_CH_QUEUE_STEP_t;
+
+/*********************************************************************************************************************
+ * LOCAL ROUTINES
+ *********************************************************************************************************************/
+
+/* Prepare the oldest transaction for transfer */
+static void XMC_I2C_CH_lBeginTransaction(XMC_I2C_CH_QUEUE_t *const queue)
+{
+  queue->tx_index = 0U;
+  queue->rx_index = 0U;
+  queue->rx_requested = 0U;
+  queue->status = XMC_I2C_CH_STATUS_OK;
+  queue->timeout = queue->transactions[queue->tail].timeout;
+  queue->start_tick = queue->ticks;
+
+  XMC_I2C_CH_ClearStatusFlag(queue->channel, XMC_I2C_CH_QUEUE_STATUS_FLAGS);
+  queue->step = (uint8_t)XMC_I2C_CH_QUEUE_STEP_START;
+}
+
+/* Remove the oldest transaction, run its completion handler and prepare the next one */
+static void XMC_I2C_CH_lCompleteTransaction(XMC_I2C_CH_QUEUE_t *const queue, const XMC_I2C_CH_STATUS_t status)
+{
+  const XMC_I2C_CH_TRANSACTION_t *const transaction = &queue->transactions[queue->tail];
+  XMC_I2C_CH_HANDLER_t handler;
+  void *context;
+  uint32_t primask;
+  uint8_t next;
+
+  handler = transaction->handler;
+  context = transaction->context;
+
+  next = XMC_RING_GetNextIndex(queue->tail, queue->size);
+
+  queue->step = (uint8_t)XMC_I2C_CH_QUEUE_STEP_IDLE;
+  queue->tail = next;
+
+  if (handler != NULL)
+  {
+    handler(status, context);
+  }
+
+  primask = XMC_EnterCriticalSection();
+  if (queue->head == queue->tail)
+  {
+    /* Queue is empty, release it */
+    queue->active = false;
+  }
+  else
+  {
+    XMC_I2C_CH_lBeginTransaction(queue);
+  }
+  XMC_ExitCriticalSection(primask);
+}
+
+/* Reset the channel after a transaction lost the bus or did not complete in time */
+static void XMC_I2C_CH_lAbortTransaction(XMC_I2C_CH_QUEUE_t *const queue, const XMC_I2C_CH_STATUS_t status)
+{
+  XMC_USIC_CH_t *const channel = queue->channel;
+
+  XMC_USIC_CH_TXFIFO_Flush(channel);
+  XMC_USIC_CH_SetMode(channel, XMC_USIC_CH_OPERATING_MODE_IDLE);
+  XMC_USIC_CH_RXFIFO_Flush(channel);
+  XMC_USIC_CH_SetMode(channel, XMC_USIC_CH_OPERATING_MODE_I2C);
+
+  XMC_I2C_CH_lCompleteTransaction(queue, status);
+}
+
+/* Move the received bytes of the current transaction from the receive FIFO to its buffer */
+static void XMC_I2C_CH_lDrainRxFifo(XMC_I2C_CH_QUEUE_t *const queue)
+{
+  XMC_USIC_CH_t *const channel = queue->channel;
+  const XMC_I2C_CH_TRANSACTION_t *const transaction = &queue->transactions[queue->tail];
+  uint32_t index = queue->rx_index;
+  uint32_t level;
+  uint32_t data;
+
+  level = XMC_USIC_CH_RXFIFO_GetLevel(channel);
+  while (level > 0U)
+  {
+    data = channel->OUTR;
+    if (index < transaction->rx_count)
+    {
+      transaction->rx_data[index] = (uint8_t)data;
+      index++;
+    }
+    level--;
+  }
+
+  queue->rx_index = (uint16_t)index;
+}
+
+/*
+ * Write the commands of the current transaction to the transmit FIFO, as far as the FIFO filling level allows.
+ * Receive commands are only issued while the receive FIFO can take their data.
+ */
+static void XMC_I2C_CH_lFeedTxFifo(XMC_I2C_CH_QUEUE_t *const queue)
+{
+  XMC_USIC_CH_t *const channel = queue->channel;
+  const XMC_I2C_CH_TRANSACTION_t *const transaction = &queue->transactions[queue->tail];
+  uint32_t address = (uint32_t)transaction->address;
+  uint32_t space;
+  bool feeding = true;
+
+  space = queue->tx_fifo_size - XMC_USIC_CH_TXFIFO_GetLevel(channel);
+  while ((space > 0U) && (feeding == true))
+  {
+    switch ((XMC_I2C_CH_QUEUE_STEP_t)queue->step)
+    {
+      case XMC_I2C_CH_QUEUE_STEP_START:
+        if (transaction->tx_count != 0U)
+        {
+          channel->IN[0U] = (uint32_t)XMC_I2C_CH_TDF_MASTER_START | address;
+          queue->step = (uint8_t)XMC_I2C_CH_QUEUE_STEP_WRITE;
+        }
+        else
+        {
+          channel->IN[0U] = (uint32_t)XMC_I2C_CH_TDF_MASTER_START | address | XMC_I2C_READ_BIT;
+          queue->step = (uint8_t)XMC_I2C_CH_QUEUE_STEP_READ;
+        }
+        space--;
+        break;
+
+      case XMC_I2C_CH_QUEUE_STEP_WRITE:
+        if (queue->tx_index < transaction->tx_count)
+        {
+          channel->IN[0U] = (uint32_t)XMC_I2C_CH_TDF_MASTER_SEND | transaction->tx_data[queue->tx_index];
+          queue->tx_index++;
+          space--;
+        }
+        else if (transaction->rx_count != 0U)
+        {
+          channel->IN[0U] = (uint32_t)XMC_I2C_CH_TDF_MASTER_RESTART | address | XMC_I2C_READ_BIT;
+          queue->step = (uint8_t)XMC_I2C_CH_QUEUE_STEP_READ;
+          space--;
+        }
+        else
+        {
+          queue->step = (uint8_t)XMC_I2C_CH_QUEUE_STEP_STOP;
+        }
+        break;
+
+      case XMC_I2C_CH_QUEUE_STEP_READ:
+        if (queue->rx_requested == transaction->rx_count)
+        {
+          queue->step = (uint8_t)XMC_I2C_CH_QUEUE_STEP_STOP;
+        }
+        else if (((uint32_t)queue->rx_requested - (uint32_t)queue->rx_index) < queue->rx_fifo_size)
+        {
+          queue->rx_requested++;
+          channel->IN[0U] = (queue->rx_requested == transaction->rx_count) ?
+                            (uint32_t)XMC_I2C_CH_TDF_MASTER_RECEIVE_NACK :
+                            (uint32_t)XMC_I2C_CH_TDF_MASTER_RECEIVE_ACK;
+          space--;
+        }
+        else
+        {
+          /* Continued from the receive FIFO event */
+          feeding = false;
+        }
+        break;
+
+      case XMC_I2C_CH_QUEUE_STEP_STOP:
+        channel->IN[0U] = (uint32_t)XMC_I2C_CH_TDF_MASTER_STOP;
+        queue->step = (uint8_t)XMC_I2C_CH_QUEUE_STEP_WAIT_STOP;
+        space--;
+        break;
+
+      default:
+        feeding = false;
+        break;
+    }
+  }
+}
+
 /*********************************************************************************************************************
  * API IMPLEMENTATION
  *********************************************************************************************************************/
@@ -400,3 +594,182 @@ void XMC_I2C_CH_DisableEvent(XMC_USIC_CH_t *const channel, const uint32_t event)
   channel->CCR &= (uint32_t)~(event&0x1fc00U);
   channel->PCR_IICMode &= (uint32_t)~((event) & 0x41fc0000U);
 }
+
+XMC_I2C_CH_STATUS_t XMC_I2C_CH_QUEUE_Init(XMC_I2C_CH_QUEUE_t *const queue,
+                                          XMC_USIC_CH_t *const channel,
+                                          const XMC_I2C_CH_QUEUE_CONFIG_t *const config)
+{
+  XMC_I2C_CH_STATUS_t status = XMC_I2C_CH_STATUS_ERROR;
+
+  XMC_ASSERT("XMC_I2C_CH_QUEUE_Init: channel not valid", XMC_USIC_IsChannelValid(channel));
+  XMC_ASSERT("XMC_I2C_CH_QUEUE_Init: transactions is invalid", (config->transactions != NULL) && (config->size > 1U));
+
+  if (XMC_USIC_CH_IsFifoConfigValid(config->tx_fifo_size, (uint32_t)config->tx_fifo_pointer, (uint32_t)config->tx_fifo_limit) &&
+      XMC_USIC_CH_IsFifoConfigValid(config->rx_fifo_size, (uint32_t)config->rx_fifo_pointer, (uint32_t)config->rx_fifo_limit) &&
+      (config->service_request <= XMC_I2C_CH_SERVICE_REQUEST_MAX))
+  {
+    queue->channel = channel;
+    queue->transactions = config->transactions;
+    queue->size = config->size;
+    queue->head = 0U;
+    queue->tail = 0U;
+    queue->active = false;
+    queue->step = (uint8_t)XMC_I2C_CH_QUEUE_STEP_IDLE;
+    queue->ticks = 0U;
+    queue->start_tick = 0U;
+    queue->timeout = 0U;
+    queue->status = XMC_I2C_CH_STATUS_OK;
+    queue->tx_fifo_size = 1UL << (uint32_t)config->tx_fifo_size;
+    queue->rx_fifo_size = 1UL << (uint32_t)config->rx_fifo_size;
+    queue->service_request = config->service_request;
+
+    XMC_USIC_CH_TXFIFO_Configure(channel,
+                                 (uint32_t)config->tx_fifo_pointer,
+                                 config->tx_fifo_size,
+                                 (uint32_t)config->tx_fifo_limit);
+    XMC_USIC_CH_RXFIFO_Configure(channel,
+                                 (uint32_t)config->rx_fifo_pointer,
+                                 config->rx_fifo_size,
+                                 (uint32_t)config->rx_fifo_limit);
+
+    XMC_USIC_CH_TXFIFO_SetInterruptNodePointer(channel,
+                                               XMC_USIC_CH_TXFIFO_INTERRUPT_NODE_POINTER_STANDARD,
+                                               (uint32_t)config->service_request);
+    XMC_USIC_CH_RXFIFO_SetInterruptNodePointer(channel,
+                                               XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_STANDARD,
+                                               (uint32_t)config->service_request);
+    XMC_USIC_CH_RXFIFO_SetInterruptNodePointer(channel,
+                                               XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_ALTERNATE,
+                                               (uint32_t)config->service_request);
+    XMC_I2C_CH_SelectInterruptNodePointer(channel, XMC_I2C_CH_INTERRUPT_NODE_POINTER_PROTOCOL,
+                                          (uint32_t)config->service_request);
+
+    XMC_USIC_CH_TXFIFO_EnableEvent(channel, (uint32_t)XMC_USIC_CH_TXFIFO_EVENT_CONF_STANDARD);
+    XMC_USIC_CH_RXFIFO_EnableEvent(channel, (uint32_t)XMC_USIC_CH_RXFIFO_EVENT_CONF_STANDARD |
+                                            (uint32_t)XMC_USIC_CH_RXFIFO_EVENT_CONF_ALTERNATE);
+    XMC_I2C_CH_EnableEvent(channel, (uint32_t)XMC_I2C_CH_EVENT_NACK |
+                                    (uint32_t)XMC_I2C_CH_EVENT_ARBITRATION_LOST |
+                                    (uint32_t)XMC_I2C_CH_EVENT_ERROR |
+                                    (uint32_t)XMC_I2C_CH_EVENT_STOP_CONDITION_RECEIVED);
+
+    status = XMC_I2C_CH_STATUS_OK;
+  }
+
+  return status;
+}
+
+XMC_I2C_CH_STATUS_t XMC_I2C_CH_QUEUE_Submit(XMC_I2C_CH_QUEUE_t *const queue,
+                                            const XMC_I2C_CH_TRANSACTION_t *const transaction)
+{
+  XMC_I2C_CH_STATUS_t status;
+  uint32_t primask;
+  uint8_t next;
+  bool start = false;
+
+  if ((((uint32_t)transaction->tx_count + (uint32_t)transaction->rx_count) == 0U) ||
+      ((transaction->tx_count != 0U) && (transaction->tx_data == NULL)) ||
+      ((transaction->rx_count != 0U) && (transaction->rx_data == NULL)) ||
+      ((transaction->address & XMC_I2C_10BIT_ADDR_MASK) == XMC_I2C_10BIT_ADDR_GROUP))
+  {
+    status = XMC_I2C_CH_STATUS_ERROR;
+  }
+  else
+  {
+    primask = XMC_EnterCriticalSection();
+
+    next = XMC_RING_GetNextIndex(queue->head, queue->size);
+
+    if (next == queue->tail)
+    {
+      /* Queue is full */
+      status = XMC_I2C_CH_STATUS_BUSY;
+    }
+    else
+    {
+      queue->transactions[queue->head] = *transaction;
+      queue->head = next;
+
+      if (queue->active == false)
+      {
+        queue->active = true;
+        XMC_I2C_CH_lBeginTransaction(queue);
+        start = true;
+      }
+      status = XMC_I2C_CH_STATUS_OK;
+    }
+
+    XMC_ExitCriticalSection(primask);
+
+    if (start == true)
+    {
+      /* The transaction is run by the interrupt handler only */
+      XMC_I2C_CH_TriggerServiceRequest(queue->channel, (uint32_t)queue->service_request);
+    }
+  }
+
+  return status;
+}
+
+void XMC_I2C_CH_QUEUE_Tick(XMC_I2C_CH_QUEUE_t *const queue)
+{
+  uint32_t ticks = queue->ticks + 1U;
+
+  queue->ticks = ticks;
+
+  if ((queue->step != (uint8_t)XMC_I2C_CH_QUEUE_STEP_IDLE) && (queue->timeout != 0U) &&
+      ((ticks - queue->start_tick) >= queue->timeout))
+  {
+    XMC_I2C_CH_TriggerServiceRequest(queue->channel, (uint32_t)queue->service_request);
+  }
+}
+
+void XMC_I2C_CH_QUEUE_IRQHandler(XMC_I2C_CH_QUEUE_t *const queue)
+{
+  XMC_USIC_CH_t *const channel = queue->channel;
+  uint32_t flags;
+
+  /* Clear first, so that an event during servicing requests the interrupt again */
+  flags = XMC_I2C_CH_GetStatusFlag(channel) & XMC_I2C_CH_QUEUE_STATUS_FLAGS;
+  XMC_I2C_CH_ClearStatusFlag(channel, flags);
+  XMC_USIC_CH_RXFIFO_ClearEvent(channel, (uint32_t)XMC_USIC_CH_RXFIFO_EVENT_STANDARD |
+                                         (uint32_t)XMC_USIC_CH_RXFIFO_EVENT_ALTERNATE);
+  XMC_USIC_CH_TXFIFO_ClearEvent(channel, (uint32_t)XMC_USIC_CH_TXFIFO_EVENT_STANDARD);
+
+  if (queue->step != (uint8_t)XMC_I2C_CH_QUEUE_STEP_IDLE)
+  {
+    XMC_I2C_CH_lDrainRxFifo(queue);
+
+    if ((queue->timeout != 0U) && ((queue->ticks - queue->start_tick) >= queue->timeout))
+    {
+      XMC_I2C_CH_lAbortTransaction(queue, XMC_I2C_CH_STATUS_TIMEOUT);
+    }
+    else if ((flags & (uint32_t)XMC_I2C_CH_STATUS_FLAG_ARBITRATION_LOST) != 0U)
+    {
+      XMC_I2C_CH_lAbortTransaction(queue, XMC_I2C_CH_STATUS_ARBITRATION_LOST);
+    }
+    else if ((flags & ((uint32_t)XMC_I2C_CH_STATUS_FLAG_ERROR | (uint32_t)XMC_I2C_CH_STATUS_FLAG_WRONG_TDF_CODE_FOUND)) != 0U)
+    {
+      XMC_I2C_CH_lAbortTransaction(queue, XMC_I2C_CH_STATUS_ERROR);
+    }
+    else if (((flags & (uint32_t)XMC_I2C_CH_STATUS_FLAG_NACK_RECEIVED) != 0U) && (queue->status == XMC_I2C_CH_STATUS_OK))
+    {
+      /* Drop the remaining commands and release the bus */
+      XMC_USIC_CH_TXFIFO_Flush(channel);
+      channel->IN[0U] = (uint32_t)XMC_I2C_CH_TDF_MASTER_STOP;
+      queue->status = XMC_I2C_CH_STATUS_NACK;
+      queue->step = (uint8_t)XMC_I2C_CH_QUEUE_STEP_WAIT_STOP;
+    }
+    else if (((flags & (uint32_t)XMC_I2C_CH_STATUS_FLAG_STOP_CONDITION_RECEIVED) != 0U) &&
+             (queue->step == (uint8_t)XMC_I2C_CH_QUEUE_STEP_WAIT_STOP))
+    {
+      XMC_I2C_CH_lCompleteTransaction(queue, queue->status);
+    }
+    else
+    {
+      /* Transaction continues */
+    }
+
+    /* Current or next transaction */
+    XMC_I2C_CH_lFeedTxFifo(queue);
+  }
+}
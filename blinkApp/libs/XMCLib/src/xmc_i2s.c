@@ -36,6 +36,9 @@
  * Change History
  * --------------
  *
+ * 2026-10-17:
+ *     - Added stream mode feeding the transmit FIFO from DMA ping-pong buffers, with 16, 24 and 32-bit samples <br>
+ *
  * 2015-08-21:
  *     - Initial <br>
  *
@@ -61,6 +64,7 @@
  * HEADER FILES
  ********************************************************************************************************************/
 
+#include <string.h>
 #include <xmc_scu.h>
 #include <xmc_i2s.h>
 
@@ -68,6 +72,40 @@
  * MACROS
  ********************************************************************************************************************/
 #define XMC_I2S_CH_OVERSAMPLING (2UL)
+#define XMC_I2S_CH_SERVICE_REQUEST_MAX (5U)
+#define XMC_I2S_CH_SYSTEM_WORD_LENGTH_MAX (64U)
+
+/*********************************************************************************************************************
+ * LOCAL ROUTINES
+ ********************************************************************************************************************/
+
+#if defined(GPDMA0)
+/* Refill the segment the DMA has just sent and hand it back to the stream */
+static void XMC_I2S_CH_lDmaEventHandler(uint32_t events, uint32_t segment, void *context)
+{
+  XMC_I2S_CH_STREAM_t *const handle = (XMC_I2S_CH_STREAM_t *)context;
+  uint32_t active;
+
+  if ((events & (uint32_t)XMC_DMA_STREAM_EVENT_SEGMENT_COMPLETE) != 0U)
+  {
+    handle->handler(&handle->buffer[segment * handle->segment_words], (uint32_t)handle->frames_per_segment,
+                    handle->context);
+
+    /* The linked list never waits for a release, the refill was late if the DMA has wrapped around into it */
+    active = XMC_DMA_STREAM_GetPosition(&handle->stream) / handle->stream.segment_bytes;
+    if (active >= handle->num_segments)
+    {
+      active = 0U;
+    }
+    if (active == segment)
+    {
+      ++handle->underruns;
+    }
+
+    XMC_DMA_STREAM_Release(&handle->stream, 1U);
+  }
+}
+#endif
 
 /*********************************************************************************************************************
  * API IMPLEMENTATION
@@ -252,3 +290,126 @@ void XMC_I2S_CH_DisableEvent(XMC_USIC_CH_t *const channel, const uint32_t event)
   channel->CCR &= (uint32_t)~(event&0x1fc00U);
   channel->PCR_IISMode &= (uint32_t)~((event >> 2U) & 0x8070U);
 }
+
+#if defined(GPDMA0)
+XMC_I2S_CH_STATUS_t XMC_I2S_CH_STREAM_Init(XMC_I2S_CH_STREAM_t *const handle,
+                                           XMC_USIC_CH_t *const channel,
+                                           const XMC_I2S_CH_STREAM_CONFIG_t *const config)
+{
+  XMC_DMA_CH_CONFIG_t dma_config;
+  XMC_DMA_STREAM_CONFIG_t stream_config;
+  XMC_USIC_CH_BRG_CONFIG_t brg_config;
+  XMC_I2S_CH_STATUS_t status = XMC_I2S_CH_STATUS_ERROR;
+  uint32_t words;
+  uint32_t segment_words;
+  uint32_t sclk;
+
+  XMC_ASSERT("XMC_I2S_CH_STREAM_Init: channel not valid", XMC_USIC_IsChannelValid(channel));
+  XMC_ASSERT("XMC_I2S_CH_STREAM_Init: buffer is NULL", (config->buffer != NULL) && (config->chain != NULL));
+
+  words = XMC_I2S_CH_STREAM_WORDS_PER_SAMPLE((uint32_t)config->sample_bits);
+  segment_words = (uint32_t)config->frames_per_segment * 2U * words;
+  sclk = config->sample_rate * 2U * (uint32_t)config->system_word_length;
+
+  if ((config->handler != NULL) &&
+      ((config->sample_bits == 16U) || (config->sample_bits == 24U) || (config->sample_bits == 32U)) &&
+      (config->system_word_length >= config->sample_bits) &&
+      (config->system_word_length <= XMC_I2S_CH_SYSTEM_WORD_LENGTH_MAX) &&
+      (segment_words > 0U) && (segment_words <= XMC_DMA_LLI_MAX_BLOCK_SIZE) &&
+      (config->tx_fifo_limit > 0U) &&
+      XMC_USIC_CH_IsFifoConfigValid(config->tx_fifo_size, (uint32_t)config->tx_fifo_pointer, (uint32_t)config->tx_fifo_limit) &&
+      (config->service_request <= XMC_I2S_CH_SERVICE_REQUEST_MAX) &&
+      (XMC_I2S_CH_SetBaudrate(channel, sclk) == XMC_I2S_CH_STATUS_OK))
+  {
+    handle->channel = channel;
+    handle->buffer = config->buffer;
+    handle->handler = config->handler;
+    handle->context = config->context;
+    handle->segment_words = segment_words;
+    handle->frames_per_segment = config->frames_per_segment;
+    handle->num_segments = config->num_segments;
+    handle->service_request = config->service_request;
+    handle->underruns = 0U;
+
+    /* Same divider calculation as the one just programmed */
+    handle->rate_error = 0;
+    if (XMC_USIC_CH_CalculateBaudrate(XMC_SCU_CLOCK_GetPeripheralClockFrequency(), sclk, XMC_I2S_CH_OVERSAMPLING,
+                                      &brg_config) == XMC_USIC_CH_STATUS_OK)
+    {
+      handle->rate_error = XMC_USIC_CH_GetBaudrateError(XMC_SCU_CLOCK_GetPeripheralClockFrequency(), sclk, &brg_config);
+    }
+
+    /* Samples above 16 bits are sent as two words of half the sample size */
+    XMC_I2S_CH_SetWordLength(channel, (uint8_t)((uint32_t)config->sample_bits / words));
+    XMC_I2S_CH_SetFrameLength(channel, config->sample_bits);
+    XMC_I2S_CH_SetSystemWordLength(channel, (uint32_t)config->system_word_length);
+
+    /* All words enter through IN[0], so left and right follow from the order of the words */
+    channel->TCSR &= (uint32_t)~USIC_CH_TCSR_WAMD_Msk;
+
+    XMC_USIC_CH_TXFIFO_Configure(channel,
+                                 (uint32_t)config->tx_fifo_pointer,
+                                 config->tx_fifo_size,
+                                 (uint32_t)config->tx_fifo_limit);
+
+    /* Request a word for every word written while the filling level is below the limit */
+    channel->TBCTR |= (uint32_t)USIC_CH_TBCTR_STBTEN_Msk;
+
+    XMC_USIC_CH_TXFIFO_SetInterruptNodePointer(channel,
+                                               XMC_USIC_CH_TXFIFO_INTERRUPT_NODE_POINTER_STANDARD,
+                                               (uint32_t)config->service_request);
+    XMC_USIC_CH_TXFIFO_EnableEvent(channel, (uint32_t)XMC_USIC_CH_TXFIFO_EVENT_CONF_STANDARD);
+
+    memset(&dma_config, 0, sizeof(dma_config));
+    dma_config.src_transfer_width = (uint32_t)XMC_DMA_CH_TRANSFER_WIDTH_16;
+    dma_config.dst_transfer_width = (uint32_t)XMC_DMA_CH_TRANSFER_WIDTH_16;
+    dma_config.src_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+    dma_config.dst_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+    dma_config.src_burst_length = (uint32_t)XMC_DMA_CH_BURST_LENGTH_1;
+    dma_config.dst_burst_length = (uint32_t)XMC_DMA_CH_BURST_LENGTH_1;
+    dma_config.transfer_flow = (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_M2P_DMA;
+    dma_config.dst_addr = (uint32_t)&channel->IN[0U];
+    dma_config.priority = XMC_DMA_CH_PRIORITY_7;
+    dma_config.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_SOFTWARE;
+    dma_config.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_HARDWARE;
+    dma_config.dst_peripheral_request = config->dma_peripheral_request;
+
+    stream_config.buffer = config->buffer;
+    stream_config.chain = config->chain;
+    stream_config.handler = XMC_I2S_CH_lDmaEventHandler;
+    stream_config.context = handle;
+    stream_config.segment_size = (uint16_t)segment_words;
+    stream_config.num_segments = config->num_segments;
+
+    if (XMC_DMA_STREAM_Init(&handle->stream, config->dma, config->dma_channel, &dma_config, &stream_config) == XMC_DMA_CH_STATUS_OK)
+    {
+      status = XMC_I2S_CH_STATUS_OK;
+    }
+  }
+
+  return status;
+}
+
+void XMC_I2S_CH_STREAM_Start(XMC_I2S_CH_STREAM_t *const handle)
+{
+  uint32_t segment;
+
+  for (segment = 0U; segment < handle->num_segments; ++segment)
+  {
+    handle->handler(&handle->buffer[segment * handle->segment_words], (uint32_t)handle->frames_per_segment,
+                    handle->context);
+  }
+
+  XMC_USIC_CH_TXFIFO_Flush(handle->channel);
+  XMC_DMA_STREAM_Start(&handle->stream);
+
+  /* The FIFO is empty, so the first word is requested by software */
+  XMC_I2S_CH_TriggerServiceRequest(handle->channel, (uint32_t)handle->service_request);
+}
+
+void XMC_I2S_CH_STREAM_Stop(XMC_I2S_CH_STREAM_t *const handle)
+{
+  XMC_DMA_STREAM_Stop(&handle->stream);
+  XMC_USIC_CH_TXFIFO_Flush(handle->channel);
+}
+#endif
@@ -36,6 +36,10 @@
  * Change History
  * --------------
  *
+ * 2026-10-17:
+ *     - Added DMA transaction queue with per transaction slave select and clock settings <br>
+ *     - Added XMC_SPI_CH_Transfer() for block transfers through the FIFOs <br>
+ *
  * 2015-02-20:
  *     - Initial <br>
  *      
@@ -60,6 +64,7 @@
  * HEADER FILES
  ********************************************************************************************************************/
 
+#include <string.h>
 #include <xmc_scu.h>
 #include <xmc_spi.h>
 
@@ -67,6 +72,240 @@
  * MACROS
  ********************************************************************************************************************/
 #define XMC_SPI_CH_OVERSAMPLING (2UL)
+#define XMC_SPI_CH_DUMMY_DATA (0xffffU)
+#define XMC_SPI_CH_MODE_RECEIVE_MASK (0xfffbU)
+#define XMC_SPI_CH_SERVICE_REQUEST_MAX (5U)
+
+/*********************************************************************************************************************
+ * LOCAL ROUTINES
+ ********************************************************************************************************************/
+
+/* Size of the transmit FIFO in words, 0 if disabled */
+static uint32_t XMC_SPI_CH_lGetTxFifoSize(const XMC_USIC_CH_t *const channel)
+{
+  uint32_t size = (uint32_t)(channel->TBCTR & USIC_CH_TBCTR_SIZE_Msk) >> USIC_CH_TBCTR_SIZE_Pos;
+
+  return ((size == 0U) ? 0U : (1UL << size));
+}
+
+/* Size of the receive FIFO in words, 0 if disabled */
+static uint32_t XMC_SPI_CH_lGetRxFifoSize(const XMC_USIC_CH_t *const channel)
+{
+  uint32_t size = (uint32_t)(channel->RBCTR & USIC_CH_RBCTR_SIZE_Msk) >> USIC_CH_RBCTR_SIZE_Pos;
+
+  return ((size == 0U) ? 0U : (1UL << size));
+}
+
+#if defined(GPDMA0)
+/* Apply the settings of a transaction that differ from the previous one and program both GPDMA channels */
+static XMC_SPI_CH_STATUS_t XMC_SPI_CH_lStartTransaction(XMC_SPI_CH_DMA_QUEUE_t *const queue)
+{
+  const XMC_SPI_CH_DMA_TRANSACTION_t *const transaction = &queue->transactions[queue->tail];
+  XMC_USIC_CH_t *const channel = queue->channel;
+  XMC_DMA_CH_CONFIG_t tx_config;
+  XMC_DMA_CH_CONFIG_t rx_config;
+  XMC_DMA_CH_TRANSFER_WIDTH_t width;
+  XMC_SPI_CH_STATUS_t status = XMC_SPI_CH_STATUS_OK;
+  uint32_t tx_mode = (uint32_t)transaction->mode;
+  bool configured = (queue->word_length != 0U);
+
+  if (transaction->baudrate != queue->baudrate)
+  {
+    status = XMC_SPI_CH_SetBaudrate(channel, transaction->baudrate);
+    queue->baudrate = (status == XMC_SPI_CH_STATUS_OK) ? transaction->baudrate : 0U;
+    ++queue->reconfigurations;
+  }
+
+  if ((configured == false) || (transaction->clock_mode != queue->clock_mode))
+  {
+    XMC_SPI_CH_ConfigureShiftClockOutput(channel, transaction->clock_mode, XMC_SPI_CH_BRG_SHIFT_CLOCK_OUTPUT_SCLK);
+    queue->clock_mode = transaction->clock_mode;
+  }
+
+  if (transaction->word_length != queue->word_length)
+  {
+    XMC_SPI_CH_SetWordLength(channel, transaction->word_length);
+    queue->word_length = transaction->word_length;
+  }
+
+  if ((transaction->mode != XMC_SPI_CH_MODE_STANDARD) && (transaction->tx_data == NULL))
+  {
+    /* Dummy words with the data lines as inputs */
+    tx_mode &= XMC_SPI_CH_MODE_RECEIVE_MASK;
+  }
+
+  channel->CCR = (channel->CCR & (uint32_t)(~USIC_CH_CCR_HPCEN_Msk)) |
+                 ((tx_mode << USIC_CH_CCR_HPCEN_Pos) & (uint32_t)USIC_CH_CCR_HPCEN_Msk);
+
+  width = (transaction->word_length > 8U) ? XMC_DMA_CH_TRANSFER_WIDTH_16 : XMC_DMA_CH_TRANSFER_WIDTH_8;
+
+  memset(&tx_config, 0, sizeof(tx_config));
+  tx_config.enable_interrupt = 1U;
+  tx_config.src_transfer_width = (uint32_t)width;
+  tx_config.dst_transfer_width = (uint32_t)width;
+  tx_config.dst_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+  tx_config.transfer_flow = (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_M2P_DMA;
+  tx_config.dst_addr = (uint32_t)&channel->TBUF[tx_mode];
+  tx_config.block_size = transaction->count;
+  tx_config.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_SINGLE_BLOCK;
+  tx_config.priority = XMC_DMA_CH_PRIORITY_6;
+  tx_config.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_SOFTWARE;
+  tx_config.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_HARDWARE;
+  tx_config.dst_peripheral_request = queue->tx_peripheral_request;
+
+  rx_config = tx_config;
+  rx_config.src_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+  rx_config.transfer_flow = (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_P2M_DMA;
+  rx_config.src_addr = (uint32_t)&channel->RBUF;
+  rx_config.dst_addr = (uint32_t)&queue->rx_dummy;
+  rx_config.dst_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+  rx_config.priority = XMC_DMA_CH_PRIORITY_7;
+  rx_config.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_HARDWARE;
+  rx_config.src_peripheral_request = queue->rx_peripheral_request;
+  rx_config.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_SOFTWARE;
+  rx_config.dst_peripheral_request = 0U;
+
+  if (transaction->tx_data == NULL)
+  {
+    tx_config.src_addr = (uint32_t)&queue->tx_dummy;
+    tx_config.src_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+  }
+  else
+  {
+    tx_config.src_addr = (uint32_t)transaction->tx_data;
+    tx_config.src_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+  }
+
+  if (transaction->rx_data != NULL)
+  {
+    rx_config.dst_addr = (uint32_t)transaction->rx_data;
+    rx_config.dst_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+  }
+
+  if ((status == XMC_SPI_CH_STATUS_OK) &&
+      (XMC_DMA_CH_Init(queue->dma, queue->rx_channel, &rx_config) == XMC_DMA_CH_STATUS_OK) &&
+      (XMC_DMA_CH_Init(queue->dma, queue->tx_channel, &tx_config) == XMC_DMA_CH_STATUS_OK))
+  {
+    XMC_SPI_CH_EnableSlaveSelect(channel, transaction->slave);
+    queue->in_transfer = true;
+    XMC_DMA_CH_Enable(queue->dma, queue->rx_channel);
+    XMC_DMA_CH_Enable(queue->dma, queue->tx_channel);
+
+    /* The transmit buffer is empty, so the first word is requested by software */
+    XMC_SPI_CH_TriggerServiceRequest(channel, (uint32_t)queue->tx_service_request);
+  }
+  else
+  {
+    status = XMC_SPI_CH_STATUS_ERROR;
+  }
+
+  return status;
+}
+
+/* Remove the oldest transaction and run its completion handler */
+static void XMC_SPI_CH_lCompleteTransaction(XMC_SPI_CH_DMA_QUEUE_t *const queue, const XMC_SPI_CH_STATUS_t status)
+{
+  const XMC_SPI_CH_DMA_TRANSACTION_t *const transaction = &queue->transactions[queue->tail];
+  XMC_SPI_CH_DMA_HANDLER_t handler;
+  void *context;
+  uint8_t next;
+
+  handler = transaction->handler;
+  context = transaction->context;
+
+  next = XMC_RING_GetNextIndex(queue->tail, queue->size);
+
+  queue->tail = next;
+
+  if (handler != NULL)
+  {
+    handler(status, context);
+  }
+}
+
+/*
+ * Start queued transactions until one is in transfer or the queue is empty.
+ * The caller owns the queue, i.e. it has set the active flag.
+ */
+static void XMC_SPI_CH_lRunQueue(XMC_SPI_CH_DMA_QUEUE_t *const queue)
+{
+  XMC_SPI_CH_STATUS_t status;
+  uint32_t primask;
+  bool running = true;
+
+  while (running == true)
+  {
+    primask = XMC_EnterCriticalSection();
+
+    if (queue->head == queue->tail)
+    {
+      /* Queue is empty, release it */
+      queue->active = false;
+      running = false;
+      XMC_ExitCriticalSection(primask);
+    }
+    else
+    {
+      XMC_ExitCriticalSection(primask);
+
+      status = XMC_SPI_CH_lStartTransaction(queue);
+      if (status == XMC_SPI_CH_STATUS_OK)
+      {
+        /* The receive channel owns the queue until its completion event */
+        running = false;
+      }
+      else
+      {
+        XMC_SPI_CH_lCompleteTransaction(queue, status);
+      }
+    }
+  }
+}
+
+/* GPDMA channel event of the DMA transaction queue */
+static void XMC_SPI_CH_lDmaEvent(XMC_SPI_CH_DMA_QUEUE_t *const queue, const uint8_t dma_channel, const XMC_DMA_CH_EVENT_t event)
+{
+  XMC_SPI_CH_STATUS_t status = XMC_SPI_CH_STATUS_OK;
+
+  /*
+   * Both channels report errors, and their events are collected before the callbacks run. An event is
+   * stale if the transaction has already been completed, or if its channel runs the next transaction.
+   */
+  if ((queue->in_transfer == true) && (XMC_DMA_CH_IsEnabled(queue->dma, dma_channel) == false))
+  {
+    queue->in_transfer = false;
+
+    if (event == XMC_DMA_CH_EVENT_ERROR)
+    {
+      XMC_DMA_CH_Disable(queue->dma, queue->tx_channel);
+      XMC_DMA_CH_Disable(queue->dma, queue->rx_channel);
+      status = XMC_SPI_CH_STATUS_ERROR;
+    }
+
+    /* The last word has been received, end the frame */
+    XMC_SPI_CH_DisableSlaveSelect(queue->channel);
+
+    XMC_SPI_CH_lCompleteTransaction(queue, status);
+    XMC_SPI_CH_lRunQueue(queue);
+  }
+}
+
+/* GPDMA transmit channel event handler, errors only */
+static void XMC_SPI_CH_lDmaTxEventHandler(XMC_DMA_CH_EVENT_t event, void *context)
+{
+  XMC_SPI_CH_DMA_QUEUE_t *const queue = (XMC_SPI_CH_DMA_QUEUE_t *)context;
+
+  XMC_SPI_CH_lDmaEvent(queue, queue->tx_channel, event);
+}
+
+/* GPDMA receive channel event handler, completes the transaction */
+static void XMC_SPI_CH_lDmaRxEventHandler(XMC_DMA_CH_EVENT_t event, void *context)
+{
+  XMC_SPI_CH_DMA_QUEUE_t *const queue = (XMC_SPI_CH_DMA_QUEUE_t *)context;
+
+  XMC_SPI_CH_lDmaEvent(queue, queue->rx_channel, event);
+}
+#endif
 
 /*********************************************************************************************************************
  * API IMPLEMENTATION
@@ -190,6 +429,234 @@ uint16_t XMC_SPI_CH_GetReceivedData(XMC_USIC_CH_t *const channel)
   return retval;
 }
 
+/* Transfers a block of data words, keeping the transmit FIFO filled and draining the receive FIFO in bursts. */
+XMC_SPI_CH_STATUS_t XMC_SPI_CH_Transfer(XMC_USIC_CH_t *const channel,
+                                        const void *const tx_data,
+                                        void *const rx_data,
+                                        const uint32_t count,
+                                        const XMC_SPI_CH_MODE_t mode)
+{
+  const uint8_t *const tx_byte = (const uint8_t *)tx_data;
+  const uint16_t *const tx_half = (const uint16_t *)tx_data;
+  uint8_t *const rx_byte = (uint8_t *)rx_data;
+  uint16_t *const rx_half = (uint16_t *)rx_data;
+  XMC_SPI_CH_STATUS_t status = XMC_SPI_CH_STATUS_ERROR;
+  uint32_t tx_fifo_size = XMC_SPI_CH_lGetTxFifoSize(channel);
+  uint32_t rx_fifo_size = XMC_SPI_CH_lGetRxFifoSize(channel);
+  uint32_t tx_mode = (uint32_t)mode;
+  uint32_t sent = 0U;
+  uint32_t received = 0U;
+  uint32_t space;
+  uint32_t level;
+  uint32_t data;
+  bool half_duplex = (mode != XMC_SPI_CH_MODE_STANDARD);
+  bool wide = (((channel->SCTR & USIC_CH_SCTR_WLE_Msk) >> USIC_CH_SCTR_WLE_Pos) > 7U);
+  bool receive = true;
+
+  if ((tx_fifo_size != 0U) && (rx_fifo_size != 0U) &&
+      ((half_duplex == false) || (tx_data == NULL) || (rx_data == NULL)))
+  {
+    if (half_duplex == true)
+    {
+      if (tx_data == NULL)
+      {
+        /* Dummy words with the data lines as inputs */
+        tx_mode &= XMC_SPI_CH_MODE_RECEIVE_MASK;
+      }
+      else
+      {
+        receive = false;
+      }
+    }
+
+    channel->CCR = (channel->CCR & (uint32_t)(~USIC_CH_CCR_HPCEN_Msk)) |
+                   ((tx_mode << USIC_CH_CCR_HPCEN_Pos) & (uint32_t)USIC_CH_CCR_HPCEN_Msk);
+
+    XMC_USIC_CH_RXFIFO_Flush(channel);
+
+    while ((sent < count) || ((receive == true) && (received < count)))
+    {
+      /* Refill the transmit FIFO, but never have more words in flight than the receive FIFO holds */
+      space = tx_fifo_size - XMC_USIC_CH_TXFIFO_GetLevel(channel);
+      if ((receive == true) && (space > (rx_fifo_size - (sent - received))))
+      {
+        space = rx_fifo_size - (sent - received);
+      }
+      if (space > (count - sent))
+      {
+        space = count - sent;
+      }
+
+      while (space > 0U)
+      {
+        if (tx_data == NULL)
+        {
+          data = XMC_SPI_CH_DUMMY_DATA;
+        }
+        else if (wide == true)
+        {
+          data = (uint32_t)tx_half[sent];
+        }
+        else
+        {
+          data = (uint32_t)tx_byte[sent];
+        }
+        channel->IN[tx_mode] = data;
+        ++sent;
+        --space;
+      }
+
+      if (receive == true)
+      {
+        /* Drain the receive FIFO */
+        level = XMC_USIC_CH_RXFIFO_GetLevel(channel);
+        while (level > 0U)
+        {
+          data = channel->OUTR;
+          if (rx_data != NULL)
+          {
+            if (wide == true)
+            {
+              rx_half[received] = (uint16_t)data;
+            }
+            else
+            {
+              rx_byte[received] = (uint8_t)data;
+            }
+          }
+          ++received;
+          --level;
+        }
+      }
+    }
+
+    if (receive == false)
+    {
+      /* Wait till the last word has been moved to the shift register */
+      while ((XMC_USIC_CH_TXFIFO_IsEmpty(channel) == false) ||
+             (((uint32_t)XMC_USIC_CH_GetTransmitBufferStatus(channel) & (uint32_t)XMC_USIC_CH_TBUF_STATUS_BUSY) != 0U))
+      {
+      }
+
+      XMC_USIC_CH_RXFIFO_Flush(channel);
+    }
+
+    status = XMC_SPI_CH_STATUS_OK;
+  }
+
+  return status;
+}
+
+#if defined(GPDMA0)
+/* Initializes a queue of DMA transactions on a master channel. */
+XMC_SPI_CH_STATUS_t XMC_SPI_CH_DMA_QUEUE_Init(XMC_SPI_CH_DMA_QUEUE_t *const queue,
+                                              XMC_USIC_CH_t *const channel,
+                                              const XMC_SPI_CH_DMA_QUEUE_CONFIG_t *const config)
+{
+  XMC_SPI_CH_STATUS_t status = XMC_SPI_CH_STATUS_ERROR;
+
+  XMC_ASSERT("XMC_SPI_CH_DMA_QUEUE_Init: transactions is invalid", (config->transactions != NULL) && (config->size > 1U));
+  XMC_ASSERT("XMC_SPI_CH_DMA_QUEUE_Init: FIFO enabled", ((channel->TBCTR & USIC_CH_TBCTR_SIZE_Msk) == 0U) &&
+                                                       ((channel->RBCTR & USIC_CH_RBCTR_SIZE_Msk) == 0U));
+
+  if ((XMC_DMA_IsEnabled(config->dma) == true) &&
+      (config->tx_channel != config->rx_channel) &&
+      (config->tx_service_request <= XMC_SPI_CH_SERVICE_REQUEST_MAX) &&
+      (config->rx_service_request <= XMC_SPI_CH_SERVICE_REQUEST_MAX))
+  {
+    queue->channel = channel;
+    queue->dma = config->dma;
+    queue->transactions = config->transactions;
+    queue->size = config->size;
+    queue->head = 0U;
+    queue->tail = 0U;
+    queue->active = false;
+    queue->in_transfer = false;
+    queue->baudrate = 0U;
+    queue->reconfigurations = 0U;
+    queue->clock_mode = XMC_SPI_CH_BRG_SHIFT_CLOCK_PASSIVE_LEVEL_0_DELAY_DISABLED;
+    queue->word_length = 0U;
+    queue->tx_dummy = XMC_SPI_CH_DUMMY_DATA;
+    queue->rx_dummy = 0U;
+    queue->tx_channel = config->tx_channel;
+    queue->rx_channel = config->rx_channel;
+    queue->tx_peripheral_request = config->tx_peripheral_request;
+    queue->rx_peripheral_request = config->rx_peripheral_request;
+    queue->tx_service_request = config->tx_service_request;
+
+    XMC_SPI_CH_SelectInterruptNodePointer(channel, XMC_SPI_CH_INTERRUPT_NODE_POINTER_TRANSMIT_BUFFER,
+                                          (uint32_t)config->tx_service_request);
+    XMC_SPI_CH_SelectInterruptNodePointer(channel, XMC_SPI_CH_INTERRUPT_NODE_POINTER_RECEIVE,
+                                          (uint32_t)config->rx_service_request);
+    XMC_SPI_CH_SelectInterruptNodePointer(channel, XMC_SPI_CH_INTERRUPT_NODE_POINTER_ALTERNATE_RECEIVE,
+                                          (uint32_t)config->rx_service_request);
+    XMC_SPI_CH_EnableEvent(channel, (uint32_t)XMC_SPI_CH_EVENT_TRANSMIT_BUFFER |
+                                    (uint32_t)XMC_SPI_CH_EVENT_STANDARD_RECEIVE |
+                                    (uint32_t)XMC_SPI_CH_EVENT_ALTERNATIVE_RECEIVE);
+
+    XMC_DMA_CH_SetEventHandlerContext(config->dma, config->rx_channel, XMC_SPI_CH_lDmaRxEventHandler, queue);
+    XMC_DMA_CH_SetEventHandlerContext(config->dma, config->tx_channel, XMC_SPI_CH_lDmaTxEventHandler, queue);
+    XMC_DMA_CH_EnableEvent(config->dma, config->rx_channel, (uint32_t)XMC_DMA_CH_EVENT_TRANSFER_COMPLETE |
+                                                            (uint32_t)XMC_DMA_CH_EVENT_ERROR);
+    XMC_DMA_CH_EnableEvent(config->dma, config->tx_channel, (uint32_t)XMC_DMA_CH_EVENT_ERROR);
+
+    status = XMC_SPI_CH_STATUS_OK;
+  }
+
+  return status;
+}
+
+/* Queues a DMA transaction and starts the queue if it is idle. */
+XMC_SPI_CH_STATUS_t XMC_SPI_CH_DMA_QUEUE_Submit(XMC_SPI_CH_DMA_QUEUE_t *const queue,
+                                                const XMC_SPI_CH_DMA_TRANSACTION_t *const transaction)
+{
+  XMC_SPI_CH_STATUS_t status;
+  uint32_t primask;
+  uint8_t next;
+  bool start = false;
+
+  if ((transaction->count == 0U) || (transaction->count > XMC_DMA_LLI_MAX_BLOCK_SIZE) ||
+      (transaction->word_length == 0U) || (transaction->word_length > 16U) ||
+      ((transaction->mode != XMC_SPI_CH_MODE_STANDARD) && (transaction->tx_data != NULL) && (transaction->rx_data != NULL)))
+  {
+    status = XMC_SPI_CH_STATUS_ERROR;
+  }
+  else
+  {
+    primask = XMC_EnterCriticalSection();
+
+    next = XMC_RING_GetNextIndex(queue->head, queue->size);
+
+    if (next == queue->tail)
+    {
+      /* Queue is full */
+      status = XMC_SPI_CH_STATUS_BUSY;
+    }
+    else
+    {
+      queue->transactions[queue->head] = *transaction;
+      queue->head = next;
+
+      if (queue->active == false)
+      {
+        queue->active = true;
+        start = true;
+      }
+      status = XMC_SPI_CH_STATUS_OK;
+    }
+
+    XMC_ExitCriticalSection(primask);
+
+    if (start == true)
+    {
+      XMC_SPI_CH_lRunQueue(queue);
+    }
+  }
+
+  return status;
+}
+#endif
+
 /* Configures the inter word delay by setting PCR.PCTQ1, PCR.DCTQ1 bit fields. */
 void XMC_SPI_CH_SetInterwordDelay(XMC_USIC_CH_t *const channel,uint32_t tinterword_delay_us)
 {
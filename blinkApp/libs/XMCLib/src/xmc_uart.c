@@ -36,6 +36,11 @@
  * Change History
  * --------------
  *
+ * 2026-10-17:
+ *     - Add COBS and SLIP framed mode on top of the buffered mode, with an optional FCE CRC trailer <br>
+ *     - Add DMA receive into a circular buffer with delivery at message end <br>
+ *     - Add interrupt driven buffered mode on the USIC FIFOs with lock-free software rings <br>
+ *
  * 2015-02-20:
  *     - Initial <br>
  *      
@@ -56,6 +61,7 @@
  * HEADER FILES
  *********************************************************************************************************************/
 
+#include <string.h>
 #include <xmc_scu.h>
 #include <xmc_uart.h>
 
@@ -65,6 +71,431 @@
  
 #define XMC_UART_CH_OVERSAMPLING (16UL)
 #define XMC_UART_CH_OVERSAMPLING_MIN_VAL (4UL)
+#define XMC_UART_CH_SERVICE_REQUEST_MAX (5U)
+#define XMC_UART_CH_PROTOCOL_STATUS_FLAGS ((uint32_t)XMC_UART_CH_STATUS_FLAG_SYNCHRONIZATION_BREAK_DETECTED | \
+                                           (uint32_t)XMC_UART_CH_STATUS_FLAG_COLLISION_DETECTED | \
+                                           (uint32_t)XMC_UART_CH_STATUS_FLAG_RECEIVER_NOISE_DETECTED | \
+                                           (uint32_t)XMC_UART_CH_STATUS_FLAG_FORMAT_ERROR_IN_STOP_BIT_0 | \
+                                           (uint32_t)XMC_UART_CH_STATUS_FLAG_FORMAT_ERROR_IN_STOP_BIT_1 | \
+                                           (uint32_t)XMC_UART_CH_STATUS_FLAG_RECEIVE_FRAME_FINISHED | \
+                                           (uint32_t)XMC_UART_CH_STATUS_FLAG_TRANSMITTER_FRAME_FINISHED)
+#define XMC_UART_CH_COBS_DELIMITER (0x00U)
+#define XMC_UART_CH_COBS_CODE_MAX (0xFFUL)
+#define XMC_UART_CH_SLIP_END (0xC0U)
+#define XMC_UART_CH_SLIP_ESC (0xDBU)
+#define XMC_UART_CH_SLIP_ESC_END (0xDCU)
+#define XMC_UART_CH_SLIP_ESC_ESC (0xDDU)
+#define XMC_UART_CH_CRC_SIZE_MAX (4U)
+
+/* Nonzero if a byte of the word is zero */
+#define XMC_UART_CH_HAS_ZERO_BYTE(word) (((word) - 0x01010101UL) & ~(word) & 0x80808080UL)
+
+/*********************************************************************************************************************
+ * DATA STRUCTURES
+ *********************************************************************************************************************/
+
+/* Framed mode encoder writing to the transmit ring ahead of its published head */
+typedef struct XMC_UART_CH_ENCODER
+{
+  XMC_UART_CH_RING_t *ring;
+  uint32_t head;
+  uint32_t code_index;
+  uint32_t code;
+} XMC_UART_CH_ENCODER_t;
+
+/*********************************************************************************************************************
+ * LOCAL ROUTINES
+ *********************************************************************************************************************/
+
+static void XMC_UART_CH_lInitRing(XMC_UART_CH_RING_t *const ring, uint8_t *const buffer, const uint32_t size)
+{
+  ring->buffer = buffer;
+  ring->mask = size - 1U;
+  ring->head = 0U;
+  ring->tail = 0U;
+}
+
+/* Move the received words to the receive ring, reading the FIFO filling level once per batch */
+static void XMC_UART_CH_lDrainRxFifo(XMC_UART_CH_BUFFERED_t *const handle)
+{
+  XMC_USIC_CH_t *const channel = handle->channel;
+  XMC_UART_CH_RING_t *const ring = &handle->rx;
+  uint32_t head = ring->head;
+  uint32_t level;
+  uint32_t space;
+  uint32_t data;
+
+  level = XMC_USIC_CH_RXFIFO_GetLevel(channel);
+  while (level > 0U)
+  {
+    space = (ring->mask + 1U) - (head - ring->tail);
+    while (level > 0U)
+    {
+      data = channel->OUTR;
+      if (space > 0U)
+      {
+        ring->buffer[head & ring->mask] = (uint8_t)data;
+        head++;
+        space--;
+      }
+      else
+      {
+        handle->rx_overruns++;
+      }
+      level--;
+    }
+
+    /* Words received meanwhile */
+    level = XMC_USIC_CH_RXFIFO_GetLevel(channel);
+  }
+
+  /* Publish the data before the index */
+  __DMB();
+  ring->head = head;
+}
+
+/* Fill the transmit FIFO from the transmit ring, as far as the FIFO filling level allows */
+static void XMC_UART_CH_lRefillTxFifo(XMC_UART_CH_BUFFERED_t *const handle)
+{
+  XMC_USIC_CH_t *const channel = handle->channel;
+  XMC_UART_CH_RING_t *const ring = &handle->tx;
+  uint32_t tail = ring->tail;
+  uint32_t count;
+  uint32_t space;
+
+  count = ring->head - tail;
+  space = handle->tx_fifo_size - XMC_USIC_CH_TXFIFO_GetLevel(channel);
+  while ((count > 0U) && (space > 0U))
+  {
+    channel->IN[0U] = ring->buffer[tail & ring->mask];
+    tail++;
+    count--;
+    space--;
+  }
+
+  /* Release the entries after they have been read */
+  __DMB();
+  ring->tail = tail;
+
+  if (count == 0U)
+  {
+    /* No transmit FIFO event follows once the ring is empty, the next write triggers the service request */
+    handle->tx_idle = true;
+
+    /* A writer preempting the refill may have queued data after the ring was read */
+    if (ring->head != tail)
+    {
+      handle->tx_idle = false;
+      XMC_USIC_CH_TriggerServiceRequest(channel, (uint32_t)handle->service_request);
+    }
+  }
+}
+
+/* Find the first byte equal to a or b, testing a word per step where the data is aligned */
+static uint32_t XMC_UART_CH_lFindByte(const uint8_t *const data, const uint32_t start, const uint32_t end,
+                                      const uint8_t a, const uint8_t b)
+{
+  uint32_t index = start;
+  uint32_t pattern_a = 0x01010101UL * (uint32_t)a;
+  uint32_t pattern_b = 0x01010101UL * (uint32_t)b;
+  uint32_t word;
+
+  while ((index < end) && ((((uint32_t)&data[index]) & 3U) != 0U) && (data[index] != a) && (data[index] != b))
+  {
+    index++;
+  }
+
+  while (((index + 4U) <= end) && ((((uint32_t)&data[index]) & 3U) == 0U))
+  {
+    word = *(const uint32_t *)(const void *)&data[index];
+    if ((XMC_UART_CH_HAS_ZERO_BYTE(word ^ pattern_a) | XMC_UART_CH_HAS_ZERO_BYTE(word ^ pattern_b)) != 0U)
+    {
+      break;
+    }
+    index += 4U;
+  }
+
+  /* Locate the byte within the word, or check the bytes after the last full word */
+  while ((index < end) && (data[index] != a) && (data[index] != b))
+  {
+    index++;
+  }
+
+  return index;
+}
+
+static void XMC_UART_CH_lEncoderPut(XMC_UART_CH_ENCODER_t *const encoder, const uint8_t data)
+{
+  encoder->ring->buffer[encoder->head & encoder->ring->mask] = data;
+  encoder->head++;
+}
+
+static void XMC_UART_CH_lEncoderCopy(XMC_UART_CH_ENCODER_t *const encoder, const uint8_t *const data, const uint32_t size)
+{
+  XMC_UART_CH_RING_t *const ring = encoder->ring;
+  uint32_t index = encoder->head & ring->mask;
+  uint32_t first = (ring->mask + 1U) - index;
+
+  if (first > size)
+  {
+    first = size;
+  }
+  memcpy(&ring->buffer[index], data, first);
+  memcpy(ring->buffer, &data[first], size - first);
+  encoder->head += size;
+}
+
+/* Write the code of the current COBS block and open the next one */
+static void XMC_UART_CH_lCobsCloseBlock(XMC_UART_CH_ENCODER_t *const encoder)
+{
+  encoder->ring->buffer[encoder->code_index & encoder->ring->mask] = (uint8_t)encoder->code;
+  encoder->code_index = encoder->head;
+  encoder->head++;
+  encoder->code = 1U;
+}
+
+static void XMC_UART_CH_lCobsEncode(XMC_UART_CH_ENCODER_t *const encoder, const uint8_t *const data, const uint32_t size)
+{
+  uint32_t index = 0U;
+  uint32_t end;
+  uint32_t count;
+
+  while (index < size)
+  {
+    end = XMC_UART_CH_lFindByte(data, index, size, XMC_UART_CH_COBS_DELIMITER, XMC_UART_CH_COBS_DELIMITER);
+    while (index < end)
+    {
+      count = end - index;
+      if (count > (XMC_UART_CH_COBS_CODE_MAX - encoder->code))
+      {
+        count = XMC_UART_CH_COBS_CODE_MAX - encoder->code;
+      }
+      XMC_UART_CH_lEncoderCopy(encoder, &data[index], count);
+      encoder->code += count;
+      index += count;
+
+      if (encoder->code == XMC_UART_CH_COBS_CODE_MAX)
+      {
+        XMC_UART_CH_lCobsCloseBlock(encoder);
+      }
+    }
+
+    if (index < size)
+    {
+      /* The zero byte is replaced by the code of the block it ends */
+      XMC_UART_CH_lCobsCloseBlock(encoder);
+      index++;
+    }
+  }
+}
+
+static void XMC_UART_CH_lSlipEncode(XMC_UART_CH_ENCODER_t *const encoder, const uint8_t *const data, const uint32_t size)
+{
+  uint32_t index = 0U;
+  uint32_t end;
+
+  while (index < size)
+  {
+    end = XMC_UART_CH_lFindByte(data, index, size, XMC_UART_CH_SLIP_END, XMC_UART_CH_SLIP_ESC);
+    XMC_UART_CH_lEncoderCopy(encoder, &data[index], end - index);
+    index = end;
+
+    if (index < size)
+    {
+      XMC_UART_CH_lEncoderPut(encoder, XMC_UART_CH_SLIP_ESC);
+      XMC_UART_CH_lEncoderPut(encoder, (data[index] == XMC_UART_CH_SLIP_END) ? XMC_UART_CH_SLIP_ESC_END :
+                                                                              XMC_UART_CH_SLIP_ESC_ESC);
+      index++;
+    }
+  }
+}
+
+/* Decode a COBS frame without its delimiter in place */
+static bool XMC_UART_CH_lCobsDecode(uint8_t *const data, const uint32_t size, uint32_t *const length)
+{
+  uint32_t read = 0U;
+  uint32_t write = 0U;
+  uint32_t count;
+  uint32_t code;
+  bool valid = true;
+
+  while ((read < size) && (valid == true))
+  {
+    code = data[read];
+    read++;
+    count = code - 1U;
+    if (count > (size - read))
+    {
+      valid = false;
+    }
+    else
+    {
+      memmove(&data[write], &data[read], count);
+      write += count;
+      read += count;
+
+      if ((code != XMC_UART_CH_COBS_CODE_MAX) && (read < size))
+      {
+        data[write] = 0U;
+        write++;
+      }
+    }
+  }
+
+  *length = write;
+  return valid;
+}
+
+/* Decode a SLIP frame without its delimiter in place */
+static bool XMC_UART_CH_lSlipDecode(uint8_t *const data, const uint32_t size, uint32_t *const length)
+{
+  uint32_t read = 0U;
+  uint32_t write = 0U;
+  uint32_t end;
+  bool valid = true;
+
+  while ((read < size) && (valid == true))
+  {
+    end = XMC_UART_CH_lFindByte(data, read, size, XMC_UART_CH_SLIP_ESC, XMC_UART_CH_SLIP_ESC);
+    memmove(&data[write], &data[read], end - read);
+    write += end - read;
+    read = end + 1U;
+
+    if (read < size)
+    {
+      if (data[read] == XMC_UART_CH_SLIP_ESC_END)
+      {
+        data[write] = XMC_UART_CH_SLIP_END;
+      }
+      else if (data[read] == XMC_UART_CH_SLIP_ESC_ESC)
+      {
+        data[write] = XMC_UART_CH_SLIP_ESC;
+      }
+      else
+      {
+        valid = false;
+      }
+      write++;
+      read++;
+    }
+    else if (read == size)
+    {
+      /* Escape as the last byte */
+      valid = false;
+    }
+    else
+    {
+      /* End of the frame */
+    }
+  }
+
+  *length = write;
+  return valid;
+}
+
+#if defined(FCE)
+/* CRC of the data zero padded to the kernel input width, one kernel write per input word */
+static uint32_t XMC_UART_CH_lCalculateCrc(const XMC_FCE_t *const engine, const uint32_t width,
+                                          const uint8_t *const data, const uint32_t size)
+{
+  uint32_t index;
+  uint32_t count;
+  uint32_t word;
+  uint32_t result;
+  uint32_t primask;
+
+  /* The kernel may be used by the sending and the receiving context */
+  primask = XMC_EnterCriticalSection();
+  XMC_FCE_InitializeSeedValue(engine, engine->seedvalue);
+  for (index = 0U; index < size; index += width)
+  {
+    word = 0U;
+    count = size - index;
+    if (count > width)
+    {
+      count = width;
+    }
+    memcpy(&word, &data[index], count);
+    engine->kernel_ptr->IR = word;
+  }
+  XMC_FCE_GetCRCResult(engine, &result);
+  XMC_ExitCriticalSection(primask);
+
+  return result;
+}
+#endif
+
+/* Decode a received frame, check its CRC trailer and pass it on */
+static void XMC_UART_CH_lDeliverFrame(XMC_UART_CH_FRAMED_t *const handle, uint8_t *const data, const uint32_t size)
+{
+  uint32_t length;
+  bool valid;
+#if defined(FCE)
+  uint32_t crc;
+  uint32_t index;
+#endif
+
+  /* Empty frames between two delimiters are ignored */
+  if (size > 0U)
+  {
+    if (handle->framing == XMC_UART_CH_FRAMING_COBS)
+    {
+      valid = XMC_UART_CH_lCobsDecode(data, size, &length);
+    }
+    else
+    {
+      valid = XMC_UART_CH_lSlipDecode(data, size, &length);
+    }
+
+#if defined(FCE)
+    if ((valid == true) && (handle->crc_size > 0U))
+    {
+      if (length < handle->crc_size)
+      {
+        valid = false;
+      }
+      else
+      {
+        length -= handle->crc_size;
+        crc = XMC_UART_CH_lCalculateCrc(handle->crc, (uint32_t)handle->crc_size, data, length);
+        for (index = 0U; index < handle->crc_size; ++index)
+        {
+          if (data[length + index] != (uint8_t)(crc >> (8U * index)))
+          {
+            valid = false;
+          }
+        }
+      }
+    }
+#endif
+
+    if (valid == true)
+    {
+      handle->handler(data, length, handle->context);
+    }
+    else
+    {
+      handle->rx_errors++;
+    }
+  }
+}
+
+#if defined(GPDMA0)
+/* DMA stream event handler of the UART DMA receive */
+static void XMC_UART_CH_lDmaRxEventHandler(uint32_t events, uint32_t segment, void *context)
+{
+  XMC_UART_CH_DMA_RX_t *const handle = (XMC_UART_CH_DMA_RX_t *)context;
+
+  XMC_UNUSED_ARG(segment);
+
+  if ((events & (uint32_t)XMC_DMA_STREAM_EVENT_SEGMENT_COMPLETE) != 0U)
+  {
+    /* The segment is passed on completely, so the stream never reports an overrun */
+    XMC_UART_CH_DMA_RX_Flush(handle);
+    XMC_DMA_STREAM_Release(&handle->stream, 1U);
+  }
+}
+#endif
 
 /*********************************************************************************************************************
  * API IMPLEMENTATION
@@ -204,3 +635,429 @@ void XMC_UART_CH_DisableEvent(XMC_USIC_CH_t *const channel, const uint32_t event
   channel->CCR &= (uint32_t)~(event&0x1fc00U);
   channel->PCR_ASCMode &= (uint32_t)~(event&0xf8U);
 }
+
+XMC_UART_CH_STATUS_t XMC_UART_CH_BUFFERED_Init(XMC_UART_CH_BUFFERED_t *const handle,
+                                               XMC_USIC_CH_t *const channel,
+                                               const XMC_UART_CH_BUFFERED_CONFIG_t *const config)
+{
+  XMC_UART_CH_STATUS_t status = XMC_UART_CH_STATUS_ERROR;
+
+  XMC_ASSERT("XMC_UART_CH_BUFFERED_Init: channel not valid", XMC_USIC_IsChannelValid(channel));
+  XMC_ASSERT("XMC_UART_CH_BUFFERED_Init: buffer is NULL", (config->tx_buffer != NULL) && (config->rx_buffer != NULL));
+
+  if ((config->tx_buffer_size != 0U) && ((config->tx_buffer_size & (config->tx_buffer_size - 1U)) == 0U) &&
+      (config->rx_buffer_size != 0U) && ((config->rx_buffer_size & (config->rx_buffer_size - 1U)) == 0U) &&
+      XMC_USIC_CH_IsFifoConfigValid(config->tx_fifo_size, (uint32_t)config->tx_fifo_pointer, (uint32_t)config->tx_fifo_limit) &&
+      XMC_USIC_CH_IsFifoConfigValid(config->rx_fifo_size, (uint32_t)config->rx_fifo_pointer, (uint32_t)config->rx_fifo_limit) &&
+      (config->service_request <= XMC_UART_CH_SERVICE_REQUEST_MAX))
+  {
+    handle->channel = channel;
+    XMC_UART_CH_lInitRing(&handle->tx, config->tx_buffer, config->tx_buffer_size);
+    XMC_UART_CH_lInitRing(&handle->rx, config->rx_buffer, config->rx_buffer_size);
+    handle->tx_fifo_size = 1UL << (uint32_t)config->tx_fifo_size;
+    handle->rx_overruns = 0U;
+    handle->service_request = config->service_request;
+    handle->tx_idle = true;
+
+    XMC_USIC_CH_TXFIFO_Configure(channel,
+                                 (uint32_t)config->tx_fifo_pointer,
+                                 config->tx_fifo_size,
+                                 (uint32_t)config->tx_fifo_limit);
+    XMC_USIC_CH_RXFIFO_Configure(channel,
+                                 (uint32_t)config->rx_fifo_pointer,
+                                 config->rx_fifo_size,
+                                 (uint32_t)config->rx_fifo_limit);
+
+    XMC_USIC_CH_TXFIFO_SetInterruptNodePointer(channel,
+                                               XMC_USIC_CH_TXFIFO_INTERRUPT_NODE_POINTER_STANDARD,
+                                               (uint32_t)config->service_request);
+    XMC_USIC_CH_RXFIFO_SetInterruptNodePointer(channel,
+                                               XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_STANDARD,
+                                               (uint32_t)config->service_request);
+    XMC_USIC_CH_RXFIFO_SetInterruptNodePointer(channel,
+                                               XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_ALTERNATE,
+                                               (uint32_t)config->service_request);
+
+    XMC_USIC_CH_TXFIFO_EnableEvent(channel, (uint32_t)XMC_USIC_CH_TXFIFO_EVENT_CONF_STANDARD);
+    XMC_USIC_CH_RXFIFO_EnableEvent(channel, (uint32_t)XMC_USIC_CH_RXFIFO_EVENT_CONF_STANDARD |
+                                            (uint32_t)XMC_USIC_CH_RXFIFO_EVENT_CONF_ALTERNATE);
+
+    status = XMC_UART_CH_STATUS_OK;
+  }
+
+  return status;
+}
+
+uint32_t XMC_UART_CH_BUFFERED_Write(XMC_UART_CH_BUFFERED_t *const handle, const uint8_t *const data, const uint32_t size)
+{
+  XMC_UART_CH_RING_t *const ring = &handle->tx;
+  uint32_t head = ring->head;
+  uint32_t count;
+  uint32_t index;
+  uint32_t first;
+
+  count = (ring->mask + 1U) - (head - ring->tail);
+  if (count > size)
+  {
+    count = size;
+  }
+
+  /* Copy in at most two pieces, up to the end of the ring and from its start */
+  index = head & ring->mask;
+  first = (ring->mask + 1U) - index;
+  if (first > count)
+  {
+    first = count;
+  }
+  memcpy(&ring->buffer[index], data, first);
+  memcpy(ring->buffer, &data[first], count - first);
+
+  /* Publish the data before the index */
+  __DMB();
+  ring->head = head + count;
+
+  if ((count > 0U) && (handle->tx_idle == true))
+  {
+    handle->tx_idle = false;
+    XMC_USIC_CH_TriggerServiceRequest(handle->channel, (uint32_t)handle->service_request);
+  }
+
+  return count;
+}
+
+uint32_t XMC_UART_CH_BUFFERED_Read(XMC_UART_CH_BUFFERED_t *const handle, uint8_t *const data, const uint32_t size)
+{
+  XMC_UART_CH_RING_t *const ring = &handle->rx;
+  uint32_t tail = ring->tail;
+  uint32_t count;
+  uint32_t index;
+  uint32_t first;
+
+  count = ring->head - tail;
+  if (count > size)
+  {
+    count = size;
+  }
+
+  index = tail & ring->mask;
+  first = (ring->mask + 1U) - index;
+  if (first > count)
+  {
+    first = count;
+  }
+  memcpy(data, &ring->buffer[index], first);
+  memcpy(&data[first], ring->buffer, count - first);
+
+  /* Release the entries after they have been read */
+  __DMB();
+  ring->tail = tail + count;
+
+  return count;
+}
+
+void XMC_UART_CH_BUFFERED_IRQHandler(XMC_UART_CH_BUFFERED_t *const handle)
+{
+  XMC_USIC_CH_t *const channel = handle->channel;
+
+  /* Clear first, so that an event during servicing requests the interrupt again */
+  XMC_USIC_CH_RXFIFO_ClearEvent(channel, (uint32_t)XMC_USIC_CH_RXFIFO_EVENT_STANDARD |
+                                         (uint32_t)XMC_USIC_CH_RXFIFO_EVENT_ALTERNATE);
+  XMC_USIC_CH_TXFIFO_ClearEvent(channel, (uint32_t)XMC_USIC_CH_TXFIFO_EVENT_STANDARD);
+
+  XMC_UART_CH_lDrainRxFifo(handle);
+  XMC_UART_CH_lRefillTxFifo(handle);
+}
+
+XMC_UART_CH_STATUS_t XMC_UART_CH_FRAMED_Init(XMC_UART_CH_FRAMED_t *const handle,
+                                             XMC_USIC_CH_t *const channel,
+                                             const XMC_UART_CH_FRAMED_CONFIG_t *const config)
+{
+  XMC_UART_CH_STATUS_t status = XMC_UART_CH_STATUS_ERROR;
+
+  XMC_ASSERT("XMC_UART_CH_FRAMED_Init: frame buffer is NULL", (config->frame_buffer != NULL));
+
+  if ((config->frame_buffer_size > 0U) && (config->handler != NULL) && (config->buffered.rx_fifo_limit == 0U))
+  {
+    handle->frame = config->frame_buffer;
+    handle->frame_size = config->frame_buffer_size;
+    handle->length = 0U;
+    handle->handler = config->handler;
+    handle->context = config->context;
+    handle->rx_errors = 0U;
+    handle->framing = config->framing;
+    handle->crc_size = 0U;
+    handle->discard = false;
+
+#if defined(FCE)
+    handle->crc = config->crc;
+    if (config->crc == NULL)
+    {
+      /* No trailer */
+    }
+    else if (config->crc->kernel_ptr == XMC_FCE_CRC8)
+    {
+      handle->crc_size = 1U;
+    }
+    else if (config->crc->kernel_ptr == XMC_FCE_CRC16)
+    {
+      handle->crc_size = 2U;
+    }
+    else
+    {
+      handle->crc_size = XMC_UART_CH_CRC_SIZE_MAX;
+    }
+#endif
+
+    status = XMC_UART_CH_BUFFERED_Init(&handle->buffered, channel, &config->buffered);
+  }
+
+  return status;
+}
+
+XMC_UART_CH_STATUS_t XMC_UART_CH_FRAMED_Send(XMC_UART_CH_FRAMED_t *const handle, const uint8_t *const data, const uint32_t size)
+{
+  XMC_UART_CH_RING_t *const ring = &handle->buffered.tx;
+  XMC_UART_CH_STATUS_t status = XMC_UART_CH_STATUS_BUSY;
+  XMC_UART_CH_ENCODER_t encoder;
+  uint8_t trailer[XMC_UART_CH_CRC_SIZE_MAX];
+  uint32_t total;
+  uint32_t encoded;
+#if defined(FCE)
+  uint32_t crc;
+  uint32_t index;
+#endif
+
+  total = size + (uint32_t)handle->crc_size;
+  if (handle->framing == XMC_UART_CH_FRAMING_COBS)
+  {
+    encoded = total + (total / (XMC_UART_CH_COBS_CODE_MAX - 1U)) + 3U;
+  }
+  else
+  {
+    encoded = (2U * total) + 2U;
+  }
+
+  if (XMC_UART_CH_BUFFERED_GetTxFree(&handle->buffered) >= encoded)
+  {
+#if defined(FCE)
+    if (handle->crc_size > 0U)
+    {
+      crc = XMC_UART_CH_lCalculateCrc(handle->crc, (uint32_t)handle->crc_size, data, size);
+      for (index = 0U; index < handle->crc_size; ++index)
+      {
+        trailer[index] = (uint8_t)(crc >> (8U * index));
+      }
+    }
+#endif
+
+    encoder.ring = ring;
+    encoder.head = ring->head;
+
+    if (handle->framing == XMC_UART_CH_FRAMING_COBS)
+    {
+      XMC_UART_CH_lEncoderPut(&encoder, XMC_UART_CH_COBS_DELIMITER);
+      encoder.code_index = encoder.head;
+      encoder.head++;
+      encoder.code = 1U;
+
+      XMC_UART_CH_lCobsEncode(&encoder, data, size);
+      XMC_UART_CH_lCobsEncode(&encoder, trailer, (uint32_t)handle->crc_size);
+
+      ring->buffer[encoder.code_index & ring->mask] = (uint8_t)encoder.code;
+      XMC_UART_CH_lEncoderPut(&encoder, XMC_UART_CH_COBS_DELIMITER);
+    }
+    else
+    {
+      XMC_UART_CH_lEncoderPut(&encoder, XMC_UART_CH_SLIP_END);
+      XMC_UART_CH_lSlipEncode(&encoder, data, size);
+      XMC_UART_CH_lSlipEncode(&encoder, trailer, (uint32_t)handle->crc_size);
+      XMC_UART_CH_lEncoderPut(&encoder, XMC_UART_CH_SLIP_END);
+    }
+
+    /* Publish the frame before the index */
+    __DMB();
+    ring->head = encoder.head;
+
+    if (handle->buffered.tx_idle == true)
+    {
+      handle->buffered.tx_idle = false;
+      XMC_USIC_CH_TriggerServiceRequest(handle->buffered.channel, (uint32_t)handle->buffered.service_request);
+    }
+
+    status = XMC_UART_CH_STATUS_OK;
+  }
+
+  return status;
+}
+
+void XMC_UART_CH_FRAMED_IRQHandler(XMC_UART_CH_FRAMED_t *const handle)
+{
+  uint8_t delimiter;
+  uint32_t count;
+  uint32_t begin;
+  uint32_t end;
+
+  delimiter = (handle->framing == XMC_UART_CH_FRAMING_COBS) ? XMC_UART_CH_COBS_DELIMITER : XMC_UART_CH_SLIP_END;
+
+  XMC_UART_CH_BUFFERED_IRQHandler(&handle->buffered);
+
+  do
+  {
+    begin = handle->length;
+    count = XMC_UART_CH_BUFFERED_Read(&handle->buffered, &handle->frame[begin], handle->frame_size - begin);
+    handle->length = begin + count;
+
+    /* Only the new bytes need to be searched */
+    end = XMC_UART_CH_lFindByte(handle->frame, begin, handle->length, delimiter, delimiter);
+    begin = 0U;
+    while (end < handle->length)
+    {
+      if (handle->discard == false)
+      {
+        XMC_UART_CH_lDeliverFrame(handle, &handle->frame[begin], end - begin);
+      }
+      handle->discard = false;
+
+      begin = end + 1U;
+      end = XMC_UART_CH_lFindByte(handle->frame, begin, handle->length, delimiter, delimiter);
+    }
+
+    /* Keep the start of the next frame */
+    if (begin > 0U)
+    {
+      handle->length -= begin;
+      memmove(handle->frame, &handle->frame[begin], handle->length);
+    }
+
+    if (handle->length == handle->frame_size)
+    {
+      /* No delimiter within the frame buffer, drop the frame up to the next one */
+      if (handle->discard == false)
+      {
+        handle->discard = true;
+        handle->rx_errors++;
+      }
+      handle->length = 0U;
+    }
+  } while (count > 0U);
+}
+
+#if defined(GPDMA0)
+XMC_UART_CH_STATUS_t XMC_UART_CH_DMA_RX_Init(XMC_UART_CH_DMA_RX_t *const handle,
+                                             XMC_USIC_CH_t *const channel,
+                                             const XMC_UART_CH_DMA_RX_CONFIG_t *const config)
+{
+  XMC_DMA_CH_CONFIG_t dma_config;
+  XMC_DMA_STREAM_CONFIG_t stream_config;
+  XMC_UART_CH_STATUS_t status = XMC_UART_CH_STATUS_ERROR;
+
+  XMC_ASSERT("XMC_UART_CH_DMA_RX_Init: channel not valid", XMC_USIC_IsChannelValid(channel));
+  XMC_ASSERT("XMC_UART_CH_DMA_RX_Init: receive FIFO enabled", (channel->RBCTR & USIC_CH_RBCTR_SIZE_Msk) == 0U);
+
+  if ((config->handler != NULL) &&
+      (config->receive_service_request <= XMC_UART_CH_SERVICE_REQUEST_MAX) &&
+      (config->message_service_request <= XMC_UART_CH_SERVICE_REQUEST_MAX))
+  {
+    handle->channel = channel;
+    handle->handler = config->handler;
+    handle->context = config->context;
+    handle->size = (uint32_t)config->segment_size * (uint32_t)config->num_segments;
+    handle->read = 0U;
+
+    /* Single byte transfers from RBUF on every receive request */
+    memset(&dma_config, 0, sizeof(dma_config));
+    dma_config.src_transfer_width = (uint32_t)XMC_DMA_CH_TRANSFER_WIDTH_8;
+    dma_config.dst_transfer_width = (uint32_t)XMC_DMA_CH_TRANSFER_WIDTH_8;
+    dma_config.src_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+    dma_config.dst_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+    dma_config.src_burst_length = (uint32_t)XMC_DMA_CH_BURST_LENGTH_1;
+    dma_config.dst_burst_length = (uint32_t)XMC_DMA_CH_BURST_LENGTH_1;
+    dma_config.transfer_flow = (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_P2M_DMA;
+    dma_config.src_addr = (uint32_t)&channel->RBUF;
+    dma_config.priority = XMC_DMA_CH_PRIORITY_7;
+    dma_config.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_HARDWARE;
+    dma_config.src_peripheral_request = config->dma_peripheral_request;
+    dma_config.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_SOFTWARE;
+
+    stream_config.buffer = config->buffer;
+    stream_config.chain = config->chain;
+    stream_config.handler = XMC_UART_CH_lDmaRxEventHandler;
+    stream_config.context = handle;
+    stream_config.segment_size = config->segment_size;
+    stream_config.num_segments = config->num_segments;
+
+    if (XMC_DMA_STREAM_Init(&handle->stream, config->dma, config->dma_channel, &dma_config, &stream_config) == XMC_DMA_CH_STATUS_OK)
+    {
+      XMC_UART_CH_SelectInterruptNodePointer(channel, XMC_UART_CH_INTERRUPT_NODE_POINTER_RECEIVE,
+                                             (uint32_t)config->receive_service_request);
+      XMC_UART_CH_SelectInterruptNodePointer(channel, XMC_UART_CH_INTERRUPT_NODE_POINTER_ALTERNATE_RECEIVE,
+                                             (uint32_t)config->receive_service_request);
+      XMC_UART_CH_SetInterruptNodePointer(channel, config->message_service_request);
+      XMC_UART_CH_ClearStatusFlag(channel, XMC_UART_CH_PROTOCOL_STATUS_FLAGS);
+      XMC_UART_CH_EnableEvent(channel, (uint32_t)XMC_UART_CH_EVENT_STANDARD_RECEIVE |
+                                       (uint32_t)XMC_UART_CH_EVENT_ALTERNATIVE_RECEIVE |
+                                       config->message_event);
+
+      status = XMC_UART_CH_STATUS_OK;
+    }
+  }
+
+  return status;
+}
+
+void XMC_UART_CH_DMA_RX_Start(XMC_UART_CH_DMA_RX_t *const handle)
+{
+  handle->read = 0U;
+  XMC_DMA_STREAM_Start(&handle->stream);
+}
+
+void XMC_UART_CH_DMA_RX_Stop(XMC_UART_CH_DMA_RX_t *const handle)
+{
+  XMC_DMA_STREAM_Stop(&handle->stream);
+  XMC_UART_CH_DMA_RX_Flush(handle);
+}
+
+void XMC_UART_CH_DMA_RX_Flush(XMC_UART_CH_DMA_RX_t *const handle)
+{
+  uint32_t position;
+  uint32_t read;
+  uint32_t primask;
+
+  /*
+   * May be called from thread context, the DMA and the message interrupt share the read index.
+   * Only the index is claimed with interrupts disabled, the handler runs with them enabled.
+   */
+  primask = XMC_EnterCriticalSection();
+  read = handle->read;
+
+  /* At the end of the buffer the channel may not have reloaded the start address yet */
+  position = XMC_DMA_STREAM_GetPosition(&handle->stream);
+  if (position >= handle->size)
+  {
+    position = 0U;
+  }
+  handle->read = position;
+
+  XMC_ExitCriticalSection(primask);
+
+  if (position != read)
+  {
+    if (position < read)
+    {
+      handle->handler(&handle->stream.buffer[read], handle->size - read, handle->context);
+      read = 0U;
+    }
+
+    if (position > read)
+    {
+      handle->handler(&handle->stream.buffer[read], position - read, handle->context);
+    }
+  }
+}
+
+void XMC_UART_CH_DMA_RX_IRQHandler(XMC_UART_CH_DMA_RX_t *const handle)
+{
+  XMC_UART_CH_ClearStatusFlag(handle->channel, XMC_UART_CH_PROTOCOL_STATUS_FLAGS);
+  XMC_UART_CH_DMA_RX_Flush(handle);
+}
+#endif
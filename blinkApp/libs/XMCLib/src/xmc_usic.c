@@ -36,6 +36,12 @@
  * Change History
  * --------------
  *
+ * 2026-10-17:
+ *     - Added bus manager APIs XMC_USIC_CH_BUS_Init(), XMC_USIC_CH_BUS_CaptureDevice(), XMC_USIC_CH_BUS_SetDeviceBaudrate(),
+ *       XMC_USIC_CH_BUS_Acquire(), XMC_USIC_CH_BUS_Request() and XMC_USIC_CH_BUS_Release() <br>
+ *     - Replaced the divider search in XMC_USIC_CH_SetBaudrate() with a continued fraction solver <br>
+ *     - Added APIs XMC_USIC_CH_CalculateBaudrate(), XMC_USIC_CH_GetBaudrateError() and XMC_USIC_CH_SetBaudrateConfig() <br>
+ *
  * 2015-02-20:
  *     - Initial draft <br>
  *     - Documentation improved <br>
@@ -71,6 +77,122 @@
  *******************************************************************************/
 
 #define USIC_CH_INPR_Msk       (0x7UL)
+#define USIC_CH_BRG_DCTQ_MAX   (32UL)
+#define USIC_FIFO_BUFFER_SIZE  (64UL)
+
+/*******************************************************************************
+ * LOCAL ROUTINES
+ *******************************************************************************/
+
+/* Distance |step * den - num * pdiv| of the fraction step / pdiv from num / den, scaled by den * pdiv */
+static uint64_t XMC_USIC_CH_lDeviation(uint64_t num, uint64_t den, uint64_t step, uint64_t pdiv)
+{
+  uint64_t lhs = step * den;
+  uint64_t rhs = num * pdiv;
+
+  return ((lhs > rhs) ? (lhs - rhs) : (rhs - lhs));
+}
+
+/*
+ * Best rational approximation step / pdiv of num / den with step <= XMC_USIC_CH_BRG_STEP_MAX and
+ * pdiv <= XMC_USIC_CH_BRG_PDIV_MAX. The convergents of the continued fraction are walked until the next one
+ * leaves the range; the largest semiconvergent still in range is then compared against the last convergent.
+ */
+static void XMC_USIC_CH_lApproximate(uint64_t num, uint64_t den, uint32_t *const step, uint32_t *const pdiv)
+{
+  uint64_t n = num;
+  uint64_t d = den;
+  uint64_t h_prev = 0U;
+  uint64_t h = 1U;
+  uint64_t k_prev = 1U;
+  uint64_t k = 0U;
+  uint64_t a;
+  uint64_t h_next;
+  uint64_t k_next;
+  uint64_t t_h;
+  uint64_t t_k;
+  uint64_t rem;
+  bool done = false;
+
+  while (done == false)
+  {
+    a = n / d;
+    h_next = (a * h) + h_prev;
+    k_next = (a * k) + k_prev;
+
+    if ((h_next > XMC_USIC_CH_BRG_STEP_MAX) || (k_next > XMC_USIC_CH_BRG_PDIV_MAX))
+    {
+      t_h = (h != 0U) ? ((XMC_USIC_CH_BRG_STEP_MAX - h_prev) / h) : a;
+      t_k = (k != 0U) ? ((XMC_USIC_CH_BRG_PDIV_MAX - k_prev) / k) : a;
+      if (t_k < t_h)
+      {
+        t_h = t_k;
+      }
+
+      h_next = (t_h * h) + h_prev;
+      k_next = (t_h * k) + k_prev;
+
+      if ((k_next != 0U) &&
+          ((k == 0U) ||
+           ((XMC_USIC_CH_lDeviation(num, den, h_next, k_next) * k) < (XMC_USIC_CH_lDeviation(num, den, h, k) * k_next))))
+      {
+        h = h_next;
+        k = k_next;
+      }
+      done = true;
+    }
+    else
+    {
+      h_prev = h;
+      h = h_next;
+      k_prev = k;
+      k = k_next;
+
+      rem = n - (a * d);
+      if (rem == 0U)
+      {
+        done = true;
+      }
+      else
+      {
+        n = d;
+        d = rem;
+      }
+    }
+  }
+
+  if (h == 0U)
+  {
+    /* Ratio below the smallest divider pair */
+    h = 1U;
+    k = XMC_USIC_CH_BRG_PDIV_MAX;
+  }
+
+  *step = (uint32_t)h;
+  *pdiv = (uint32_t)k;
+}
+
+/* Program the register image of a device, called by the owner of the bus */
+static void XMC_USIC_CH_lSelectDevice(XMC_USIC_CH_BUS_t *const bus, const XMC_USIC_CH_BUS_DEVICE_t *const device)
+{
+  XMC_USIC_CH_t *const channel = bus->channel;
+
+  if (bus->device != device)
+  {
+    /* The protocol may only be changed from idle mode */
+    channel->CCR = 0U;
+    channel->FDR = device->fdr;
+    channel->BRG = device->brg;
+    channel->DXCR[0U] = device->dxcr[0U];
+    channel->DXCR[1U] = device->dxcr[1U];
+    channel->DXCR[2U] = device->dxcr[2U];
+    channel->SCTR = device->sctr;
+    channel->TCSR = device->tcsr;
+    channel->PCR = device->pcr;
+    channel->CCR = device->ccr;
+    bus->device = device;
+  }
+}
 
 /*******************************************************************************
  * API IMPLEMENTATION
@@ -117,57 +239,86 @@ void XMC_USIC_CH_Disable(XMC_USIC_CH_t *const channel)
   channel->KSCFG = (uint32_t)((channel->KSCFG & (~USIC_CH_KSCFG_MODEN_Msk)) | USIC_CH_KSCFG_BPMODEN_Msk);
 }
 
-XMC_USIC_CH_STATUS_t XMC_USIC_CH_SetBaudrate(XMC_USIC_CH_t *const channel, uint32_t rate, uint32_t oversampling)
+XMC_USIC_CH_STATUS_t XMC_USIC_CH_CalculateBaudrate(uint32_t peripheral_clock,
+                                                   uint32_t rate,
+                                                   uint32_t oversampling,
+                                                   XMC_USIC_CH_BRG_CONFIG_t *const config)
 {
   XMC_USIC_CH_STATUS_t status;
-  
-  uint32_t peripheral_clock;
-  
-  uint32_t clock_divider;
-  uint32_t clock_divider_min;
-
+  uint32_t step;
   uint32_t pdiv;
-  uint32_t pdiv_int;
-  uint32_t pdiv_int_min;
-  
-  uint32_t pdiv_frac;
-  uint32_t pdiv_frac_min;
 
-  /* The rate and peripheral clock are divided by 100 to be able to use only 32bit arithmetic */
-  if ((rate >= 100U) && (oversampling != 0U))
+  XMC_ASSERT("XMC_USIC_CH_CalculateBaudrate: config not valid", (config != NULL));
+
+  if ((peripheral_clock != 0U) && (rate != 0U) && (oversampling != 0U) && (oversampling <= USIC_CH_BRG_DCTQ_MAX))
   {
-    peripheral_clock = XMC_SCU_CLOCK_GetPeripheralClockFrequency() / 100U;
-    rate = rate / 100U;
+    /* fperiph * step / (1024 * pdiv * oversampling) = rate */
+    XMC_USIC_CH_lApproximate(1024ULL * (uint64_t)rate * (uint64_t)oversampling, (uint64_t)peripheral_clock, &step, &pdiv);
 
-    clock_divider_min = 1U;
-    pdiv_int_min = 1U;
-    pdiv_frac_min = 0x3ffU;
+    config->step = (uint16_t)step;
+    config->pdiv = (uint16_t)pdiv;
+    config->oversampling = (uint16_t)oversampling;
 
-    for(clock_divider = 1023U; clock_divider > 0U; --clock_divider)
-    {
-      pdiv = ((peripheral_clock * clock_divider) / (rate * oversampling));
-      pdiv_int = pdiv >> 10U;
-      pdiv_frac = pdiv & 0x3ffU;
+    status = XMC_USIC_CH_STATUS_OK;
+  }
+  else
+  {
+    status = XMC_USIC_CH_STATUS_ERROR;
+  }
 
-      if ((pdiv_int < 1024U) && (pdiv_frac < pdiv_frac_min))
-      {
-        pdiv_frac_min = pdiv_frac;
-        pdiv_int_min = pdiv_int;
-        clock_divider_min = clock_divider;
-      }
-    }
+  return status;
+}
 
-    channel->FDR = XMC_USIC_CH_BRG_CLOCK_DIVIDER_MODE_FRACTIONAL |
-                   (clock_divider_min << USIC_CH_FDR_STEP_Pos);
+int32_t XMC_USIC_CH_GetBaudrateError(uint32_t peripheral_clock,
+                                     uint32_t rate,
+                                     const XMC_USIC_CH_BRG_CONFIG_t *const config)
+{
+  int64_t generated;
+  int64_t desired;
 
-    channel->BRG = (channel->BRG & ~(USIC_CH_BRG_DCTQ_Msk |
-                                     USIC_CH_BRG_PDIV_Msk |
-                                     USIC_CH_BRG_PCTQ_Msk |
-                                     USIC_CH_BRG_PPPEN_Msk)) |
-                   ((oversampling - 1U) << USIC_CH_BRG_DCTQ_Pos) |
-                   ((pdiv_int_min - 1U) << USIC_CH_BRG_PDIV_Pos);
-                    
-    status = XMC_USIC_CH_STATUS_OK;
+  XMC_ASSERT("XMC_USIC_CH_GetBaudrateError: config not valid", (config != NULL));
+  XMC_ASSERT("XMC_USIC_CH_GetBaudrateError: rate not valid", (rate != 0U));
+
+  /* Both sides scaled by 1024 * pdiv * oversampling */
+  generated = (int64_t)peripheral_clock * (int64_t)config->step;
+  desired = 1024LL * (int64_t)rate * (int64_t)config->pdiv * (int64_t)config->oversampling;
+
+  return (int32_t)(((generated - desired) * 1000000LL) / desired);
+}
+
+void XMC_USIC_CH_SetBaudrateConfig(XMC_USIC_CH_t *const channel, const XMC_USIC_CH_BRG_CONFIG_t *const config)
+{
+  XMC_ASSERT("XMC_USIC_CH_SetBaudrateConfig: config not valid", (config != NULL));
+  XMC_ASSERT("XMC_USIC_CH_SetBaudrateConfig: step out of range",
+             ((config->step >= 1U) && (config->step <= XMC_USIC_CH_BRG_STEP_MAX)));
+  XMC_ASSERT("XMC_USIC_CH_SetBaudrateConfig: divider out of range",
+             ((config->pdiv >= 1U) && (config->pdiv <= XMC_USIC_CH_BRG_PDIV_MAX)));
+  XMC_ASSERT("XMC_USIC_CH_SetBaudrateConfig: oversampling out of range",
+             ((config->oversampling >= 1U) && (config->oversampling <= USIC_CH_BRG_DCTQ_MAX)));
+
+  channel->FDR = XMC_USIC_CH_BRG_CLOCK_DIVIDER_MODE_FRACTIONAL |
+                 ((uint32_t)config->step << USIC_CH_FDR_STEP_Pos);
+
+  channel->BRG = (channel->BRG & ~(USIC_CH_BRG_DCTQ_Msk |
+                                   USIC_CH_BRG_PDIV_Msk |
+                                   USIC_CH_BRG_PCTQ_Msk |
+                                   USIC_CH_BRG_PPPEN_Msk)) |
+                 (((uint32_t)config->oversampling - 1U) << USIC_CH_BRG_DCTQ_Pos) |
+                 (((uint32_t)config->pdiv - 1U) << USIC_CH_BRG_PDIV_Pos);
+}
+
+XMC_USIC_CH_STATUS_t XMC_USIC_CH_SetBaudrate(XMC_USIC_CH_t *const channel, uint32_t rate, uint32_t oversampling)
+{
+  XMC_USIC_CH_STATUS_t status;
+  XMC_USIC_CH_BRG_CONFIG_t config;
+
+  if (rate >= 100U)
+  {
+    status = XMC_USIC_CH_CalculateBaudrate(XMC_SCU_CLOCK_GetPeripheralClockFrequency(), rate, oversampling, &config);
+    if (status == XMC_USIC_CH_STATUS_OK)
+    {
+      XMC_USIC_CH_SetBaudrateConfig(channel, &config);
+    }
   }
   else 
   {
@@ -200,6 +351,17 @@ void XMC_USIC_CH_ConfigExternalInputSignalToBRG(XMC_USIC_CH_t *const channel,
                   (((pdiv) - 1U) << USIC_CH_BRG_PDIV_Pos);
 }
 
+bool XMC_USIC_CH_IsFifoConfigValid(const XMC_USIC_CH_FIFO_SIZE_t size,
+                                   const uint32_t data_pointer,
+                                   const uint32_t limit)
+{
+  uint32_t words = 1UL << (uint32_t)size;
+
+  return ((size != XMC_USIC_CH_FIFO_DISABLED) &&
+          ((data_pointer + words) <= USIC_FIFO_BUFFER_SIZE) &&
+          (limit < words));
+}
+
 void XMC_USIC_CH_TXFIFO_Configure(XMC_USIC_CH_t *const channel,
                                   const uint32_t data_pointer,
                                   const XMC_USIC_CH_FIFO_SIZE_t size,
@@ -371,3 +533,134 @@ void XMC_USIC_Disable(XMC_USIC_t *const usic)
   }
   
 }
+
+void XMC_USIC_CH_BUS_Init(XMC_USIC_CH_BUS_t *const bus, XMC_USIC_CH_t *const channel)
+{
+  XMC_ASSERT("XMC_USIC_CH_BUS_Init: channel not valid", XMC_USIC_IsChannelValid(channel));
+
+  bus->channel = channel;
+  bus->device = NULL;
+  bus->pending = NULL;
+  bus->locked = false;
+}
+
+void XMC_USIC_CH_BUS_CaptureDevice(const XMC_USIC_CH_t *const channel, XMC_USIC_CH_BUS_DEVICE_t *const device)
+{
+  XMC_ASSERT("XMC_USIC_CH_BUS_CaptureDevice: channel not valid", XMC_USIC_IsChannelValid(channel));
+
+  device->fdr = channel->FDR & (uint32_t)(USIC_CH_FDR_STEP_Msk | USIC_CH_FDR_DM_Msk);
+  device->brg = channel->BRG;
+  device->dxcr[0U] = channel->DXCR[0U];
+  device->dxcr[1U] = channel->DXCR[1U];
+  device->dxcr[2U] = channel->DXCR[2U];
+  device->sctr = channel->SCTR;
+  device->tcsr = channel->TCSR;
+  device->pcr = channel->PCR;
+  device->ccr = channel->CCR;
+}
+
+void XMC_USIC_CH_BUS_SetDeviceBaudrate(XMC_USIC_CH_BUS_DEVICE_t *const device, const XMC_USIC_CH_BRG_CONFIG_t *const config)
+{
+  XMC_ASSERT("XMC_USIC_CH_BUS_SetDeviceBaudrate: config not valid", (config != NULL));
+  XMC_ASSERT("XMC_USIC_CH_BUS_SetDeviceBaudrate: step out of range",
+             ((config->step >= 1U) && (config->step <= XMC_USIC_CH_BRG_STEP_MAX)));
+  XMC_ASSERT("XMC_USIC_CH_BUS_SetDeviceBaudrate: divider out of range",
+             ((config->pdiv >= 1U) && (config->pdiv <= XMC_USIC_CH_BRG_PDIV_MAX)));
+  XMC_ASSERT("XMC_USIC_CH_BUS_SetDeviceBaudrate: oversampling out of range",
+             ((config->oversampling >= 1U) && (config->oversampling <= USIC_CH_BRG_DCTQ_MAX)));
+
+  device->fdr = XMC_USIC_CH_BRG_CLOCK_DIVIDER_MODE_FRACTIONAL |
+                ((uint32_t)config->step << USIC_CH_FDR_STEP_Pos);
+
+  device->brg = (device->brg & ~(uint32_t)(USIC_CH_BRG_DCTQ_Msk |
+                                           USIC_CH_BRG_PDIV_Msk |
+                                           USIC_CH_BRG_PCTQ_Msk |
+                                           USIC_CH_BRG_PPPEN_Msk)) |
+                (((uint32_t)config->oversampling - 1U) << USIC_CH_BRG_DCTQ_Pos) |
+                (((uint32_t)config->pdiv - 1U) << USIC_CH_BRG_PDIV_Pos);
+}
+
+XMC_USIC_CH_STATUS_t XMC_USIC_CH_BUS_Acquire(XMC_USIC_CH_BUS_t *const bus, const XMC_USIC_CH_BUS_DEVICE_t *const device)
+{
+  XMC_USIC_CH_STATUS_t status = XMC_USIC_CH_STATUS_BUSY;
+  uint32_t primask;
+
+  XMC_ASSERT("XMC_USIC_CH_BUS_Acquire: device not valid", (device != NULL));
+
+  primask = XMC_EnterCriticalSection();
+  if ((bus->locked == false) && (bus->pending == NULL))
+  {
+    bus->locked = true;
+    status = XMC_USIC_CH_STATUS_OK;
+  }
+  XMC_ExitCriticalSection(primask);
+
+  if (status == XMC_USIC_CH_STATUS_OK)
+  {
+    XMC_USIC_CH_lSelectDevice(bus, device);
+  }
+
+  return status;
+}
+
+void XMC_USIC_CH_BUS_Request(XMC_USIC_CH_BUS_t *const bus, XMC_USIC_CH_BUS_REQUEST_t *const request)
+{
+  XMC_USIC_CH_BUS_REQUEST_t **link;
+  bool granted = false;
+  uint32_t primask;
+
+  XMC_ASSERT("XMC_USIC_CH_BUS_Request: request not valid",
+             ((request->device != NULL) && (request->handler != NULL)));
+
+  primask = XMC_EnterCriticalSection();
+  if (bus->locked == false)
+  {
+    bus->locked = true;
+    granted = true;
+  }
+  else
+  {
+    /* Keep the list sorted, first come first served among equal priorities */
+    link = &bus->pending;
+    while ((*link != NULL) && ((*link)->priority >= request->priority))
+    {
+      link = &(*link)->next;
+    }
+    request->next = *link;
+    *link = request;
+  }
+  XMC_ExitCriticalSection(primask);
+
+  if (granted == true)
+  {
+    XMC_USIC_CH_lSelectDevice(bus, request->device);
+    request->handler(request->context);
+  }
+}
+
+void XMC_USIC_CH_BUS_Release(XMC_USIC_CH_BUS_t *const bus)
+{
+  XMC_USIC_CH_BUS_REQUEST_t *request;
+  uint32_t primask;
+
+  XMC_ASSERT("XMC_USIC_CH_BUS_Release: bus not locked", (bus->locked == true));
+
+  primask = XMC_EnterCriticalSection();
+  request = bus->pending;
+  if (request == NULL)
+  {
+    bus->locked = false;
+  }
+  else
+  {
+    /* Hand the lock over without unlocking in between */
+    bus->pending = request->next;
+  }
+  XMC_ExitCriticalSection(primask);
+
+  if (request != NULL)
+  {
+    XMC_USIC_CH_lSelectDevice(bus, request->device);
+    request->handler(request->context);
+  }
+}